@@ -1053,6 +1053,126 @@ void C2_MacroAssembler::string_indexof_char_sve(Register str1, Register cnt1,
   BIND(DONE);
 }
 
+// Search for the needle str2[0..cnt2) in the haystack str1[0..cnt1).
+//
+// Each iteration compares a whole vector of candidate start positions at
+// once: a position is a candidate only if both the first and the last
+// char of the needle match there. Candidates are then verified one at a
+// time with a scalar loop, so long needles cost little more than a
+// single char search as long as candidates are rare.
+void C2_MacroAssembler::string_indexof_sve(Register str1, Register cnt1,
+                                           Register str2, Register cnt2,
+                                           Register result, Register tmp1,
+                                           Register tmp2, Register tmp3,
+                                           Register tmp4, Register tmp5, Register tmp6,
+                                           FloatRegister ztmp1, FloatRegister ztmp2,
+                                           FloatRegister ztmp3, FloatRegister ztmp4,
+                                           PRegister pgtmp, PRegister ptmp1,
+                                           PRegister ptmp2, int ae)
+{
+  assert(pgtmp->is_governing(),
+         "this register has to be a governing predicate register");
+  assert(ae != StrIntrinsicNode::LU, "Invalid encoding");
+
+  bool str1_isL = (ae == StrIntrinsicNode::LL);
+  bool str2_isL = (ae == StrIntrinsicNode::LL || ae == StrIntrinsicNode::UL);
+  int str1_shift = str1_isL ? 0 : 1;
+  int str2_shift = str2_isL ? 0 : 1;
+  SIMD_RegVariant T = str1_isL ? B : H;
+
+  Label LOOP, NEXT, CANDIDATE, VERIFY, REJECT, NOMATCH, DONE;
+
+  Register ch1       = tmp1;
+  Register ch2       = tmp2;
+  Register limit     = tmp3;
+  Register last_base = tmp4;
+  Register cand      = tmp5;
+  Register cand_addr = tmp6;
+  Register idx       = rscratch1;
+  Register cnt       = rscratch2;  // vector length, then verify index
+
+  chr_insn str1_load_1chr = str1_isL ? (chr_insn)&MacroAssembler::ldrb :
+                                      (chr_insn)&MacroAssembler::ldrh;
+  chr_insn str2_load_1chr = str2_isL ? (chr_insn)&MacroAssembler::ldrb :
+                                      (chr_insn)&MacroAssembler::ldrh;
+
+  mov(result, zr);
+  cbzw(cnt2, DONE);
+
+  // Number of candidate start positions.
+  subsw(limit, cnt1, cnt2);
+  br(LT, NOMATCH);
+  addw(limit, limit, 1);
+
+  // Broadcast the first and the last char of the needle.
+  (this->*str2_load_1chr)(ch1, Address(str2));
+  subw(cnt, cnt2, 1);
+  add(last_base, str2, cnt, ext::uxtw, str2_shift);
+  (this->*str2_load_1chr)(ch2, Address(last_base));
+  sve_dup(ztmp3, T, ch1);
+  sve_dup(ztmp4, T, ch2);
+  add(last_base, str1, cnt, ext::uxtw, str1_shift);
+
+  mov(idx, zr);
+  sve_whileltw(pgtmp, T, idx, limit);
+
+  BIND(LOOP);
+    if (str1_isL) {
+      sve_ld1b(ztmp1, T, pgtmp, Address(str1, idx));
+      sve_ld1b(ztmp2, T, pgtmp, Address(last_base, idx));
+    } else {
+      sve_ld1h(ztmp1, T, pgtmp, Address(str1, idx, Address::lsl(1)));
+      sve_ld1h(ztmp2, T, pgtmp, Address(last_base, idx, Address::lsl(1)));
+    }
+    sve_cmp(Assembler::EQ, ptmp1, T, pgtmp, ztmp1, ztmp3);
+    sve_cmp(Assembler::EQ, ptmp2, T, pgtmp, ztmp2, ztmp4);
+    sve_ands(ptmp1, pgtmp, ptmp1, ptmp2);
+    br(NE, CANDIDATE);
+
+  BIND(NEXT);
+    if (str1_isL) {
+      sve_cntb(cnt);
+    } else {
+      sve_cnth(cnt);
+    }
+    add(idx, idx, cnt);
+    sve_whileltw(pgtmp, T, idx, limit);
+    br(MI, LOOP);
+
+  BIND(NOMATCH);
+    mov(result, -1);
+    b(DONE);
+
+  BIND(CANDIDATE);
+    // Position of the first remaining candidate in this vector.
+    sve_brkb(ptmp2, pgtmp, ptmp1, false /* isMerge */);
+    mov(cand, idx);
+    sve_incp(cand, T, ptmp2);
+
+    add(cand_addr, str1, cand, Assembler::LSL, str1_shift);
+    mov(cnt, zr);
+  BIND(VERIFY);
+    (this->*str1_load_1chr)(ch1, Address(cand_addr, cnt, Address::lsl(str1_shift)));
+    (this->*str2_load_1chr)(ch2, Address(str2, cnt, Address::lsl(str2_shift)));
+    cmpw(ch1, ch2);
+    br(NE, REJECT);
+    add(cnt, cnt, 1);
+    cmpw(cnt, cnt2);
+    br(LT, VERIFY);
+    mov(result, cand);
+    b(DONE);
+
+  BIND(REJECT);
+    // Drop the candidate just tried and look at the next one, if any.
+    sve_brka(ptmp2, pgtmp, ptmp1, false /* isMerge */);
+    sve_bic(ptmp1, pgtmp, ptmp1, ptmp2);
+    sve_ptest(pgtmp, ptmp1);
+    br(NE, CANDIDATE);
+    b(NEXT);
+
+  BIND(DONE);
+}
+
 void C2_MacroAssembler::stringL_indexof_char(Register str1, Register cnt1,
                                             Register ch, Register result,
                                             Register tmp1, Register tmp2, Register tmp3)
@@ -1353,6 +1473,104 @@ void C2_MacroAssembler::string_compare(Register str1, Register str2,
   BLOCK_COMMENT("} string_compare");
 }
 
+// jdk.internal.util.ArraysSupport.vectorizedHashCode
+void C2_MacroAssembler::arrays_hashcode(Register ary, Register cnt, Register result,
+                                        Register tmp1, Register tmp2, Register tmp3,
+                                        Register tmp4, BasicType eltype) {
+  assert_different_registers(ary, cnt, result, tmp1, tmp2, tmp3, tmp4, rscratch1, rscratch2);
+
+  const int elsize = arrays_hashcode_elsize(eltype);
+  const int chunks_end_shift = exact_log2(elsize);
+
+  switch (eltype) {
+  case T_BOOLEAN: BLOCK_COMMENT("arrays_hashcode(unsigned byte) {"); break;
+  case T_CHAR:    BLOCK_COMMENT("arrays_hashcode(char) {");          break;
+  case T_BYTE:    BLOCK_COMMENT("arrays_hashcode(byte) {");          break;
+  case T_SHORT:   BLOCK_COMMENT("arrays_hashcode(short) {");         break;
+  case T_INT:     BLOCK_COMMENT("arrays_hashcode(int) {");           break;
+  default:
+    ShouldNotReachHere();
+  }
+
+  const int stride = 4;
+  const Register pow31_4 = tmp1;
+  const Register pow31_3 = tmp2;
+  const Register pow31_2 = tmp3;
+  const Register chunks_end = tmp4;
+
+  Label DONE, TAIL, TAIL_LOOP, WIDE_LOOP;
+
+  // result has a value initially
+
+  cbzw(cnt, DONE);
+
+  andw(chunks_end, cnt, ~(stride - 1));
+  cbzw(chunks_end, TAIL);
+
+  movw(pow31_4, 923521);                      // [31^^4]
+  movw(pow31_3,  29791);                      // [31^^3]
+  movw(pow31_2,    961);                      // [31^^2]
+
+  add(chunks_end, ary, chunks_end, ext::uxtw, chunks_end_shift);
+  andw(cnt, cnt, stride - 1);                 // don't forget about tail!
+
+  bind(WIDE_LOOP);
+  mulw(result, result, pow31_4);              // 31^^4 * h
+  arrays_hashcode_elload(rscratch1, Address(ary, 0 * elsize), eltype);
+  arrays_hashcode_elload(rscratch2, Address(ary, 1 * elsize), eltype);
+  maddw(result, rscratch1, pow31_3, result);  // + 31^^3 * ary[i+0]
+  maddw(result, rscratch2, pow31_2, result);  // + 31^^2 * ary[i+1]
+  arrays_hashcode_elload(rscratch1, Address(ary, 2 * elsize), eltype);
+  arrays_hashcode_elload(rscratch2, Address(ary, 3 * elsize), eltype);
+  addw(result, result, rscratch1, Assembler::LSL, 5); // + 31^^1 * ary[i+2], computed
+  subw(result, result, rscratch1);            //   as (ary[i+2] << 5) - ary[i+2]
+  addw(result, result, rscratch2);            // + 31^^0 * ary[i+3]
+  add(ary, ary, elsize * stride);
+  cmp(ary, chunks_end);
+  br(NE, WIDE_LOOP);
+  cbzw(cnt, DONE);
+
+  bind(TAIL);
+  add(chunks_end, ary, cnt, ext::uxtw, chunks_end_shift);
+
+  bind(TAIL_LOOP);
+  arrays_hashcode_elload(rscratch1, Address(post(ary, elsize)), eltype);
+  lslw(rscratch2, result, 5);                 // 31 * result, computed
+  subw(result, rscratch2, result);            //   as (result << 5) - result
+  addw(result, result, rscratch1);
+  cmp(ary, chunks_end);
+  br(NE, TAIL_LOOP);
+
+  bind(DONE);
+  BLOCK_COMMENT("} // arrays_hashcode");
+}
+
+int C2_MacroAssembler::arrays_hashcode_elsize(BasicType eltype) {
+  switch (eltype) {
+  case T_BOOLEAN: return sizeof(jboolean);
+  case T_BYTE:    return sizeof(jbyte);
+  case T_SHORT:   return sizeof(jshort);
+  case T_CHAR:    return sizeof(jchar);
+  case T_INT:     return sizeof(jint);
+  default:
+    ShouldNotReachHere();
+    return -1;
+  }
+}
+
+void C2_MacroAssembler::arrays_hashcode_elload(Register dst, Address src, BasicType eltype) {
+  switch (eltype) {
+  // T_BOOLEAN used as surrogate for unsigned byte
+  case T_BOOLEAN: ldrb(dst, src);   break;
+  case T_BYTE:    ldrsbw(dst, src); break;
+  case T_SHORT:   ldrshw(dst, src); break;
+  case T_CHAR:    ldrh(dst, src);   break;
+  case T_INT:     ldrw(dst, src);   break;
+  default:
+    ShouldNotReachHere();
+  }
+}
+
 void C2_MacroAssembler::neon_compare(FloatRegister dst, BasicType bt, FloatRegister src1,
                                      FloatRegister src2, Condition cond, bool isQ) {
   SIMD_Arrangement size = esize2arrangement((unsigned)type2aelembytes(bt), isQ);
@@ -48,6 +48,14 @@
                       FloatRegister vtmp2, FloatRegister vtmp3,
                       PRegister pgtmp1, PRegister pgtmp2, int ae);
 
+  void arrays_hashcode(Register ary, Register cnt, Register result,
+                       Register tmp1, Register tmp2, Register tmp3,
+                       Register tmp4, BasicType eltype);
+
+  // helper functions for arrays_hashcode
+  int arrays_hashcode_elsize(BasicType eltype);
+  void arrays_hashcode_elload(Register dst, Address src, BasicType eltype);
+
   void string_indexof(Register str1, Register str2,
                       Register cnt1, Register cnt2,
                       Register tmp1, Register tmp2,
@@ -68,6 +76,16 @@
                                FloatRegister ztmp1, FloatRegister ztmp2,
                                PRegister pgtmp, PRegister ptmp, bool isL);
 
+  void string_indexof_sve(Register str1, Register cnt1,
+                          Register str2, Register cnt2,
+                          Register result, Register tmp1,
+                          Register tmp2, Register tmp3,
+                          Register tmp4, Register tmp5, Register tmp6,
+                          FloatRegister ztmp1, FloatRegister ztmp2,
+                          FloatRegister ztmp3, FloatRegister ztmp4,
+                          PRegister pgtmp, PRegister ptmp1,
+                          PRegister ptmp2, int ae);
+
   // Compress the least significant bit of each byte to the rightmost and clear
   // the higher garbage bits.
   void bytemask_compress(Register dst);
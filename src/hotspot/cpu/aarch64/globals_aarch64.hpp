@@ -126,6 +126,9 @@ define_pd_global(intx, InlineSmallCode,          1000);
           "Branch Protection to use: none, standard, pac-ret")          \
   product(bool, AlwaysMergeDMB, true, DIAGNOSTIC,                       \
           "Always merge DMB instructions in code emission")             \
+  product(bool, UseSVEStringIndexOf, false, DIAGNOSTIC,                 \
+          "Use the SVE substring search for String.indexOf when "       \
+          "UseSVE > 0")                                                 \
 
 // end of ARCH_FLAGS
 
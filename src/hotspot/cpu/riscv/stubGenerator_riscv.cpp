@@ -4659,6 +4659,72 @@ class StubGenerator: public StubCodeGenerator {
     __ vrole32_vi(bVec, 7, tmp_vr);
   }
 
+  // Arguments:
+  //
+  // Inputs:
+  //   c_rarg0   - source byte array address
+  //   c_rarg1   - destination byte array address
+  //   c_rarg2   - K (key) in little endian int array
+  //
+  // The expanded key is stored by Java as big-endian words, so each round
+  // key is byte-reversed with vrev8 before it is handed to Zvkned, which
+  // expects the round key bytes in memory order.
+  address generate_aescrypt_encryptBlock() {
+    assert(UseAESIntrinsics && UseZvkn, "need Zvkned support");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "aescrypt_encryptBlock");
+    address start = __ pc();
+
+    Label L_rounds;
+
+    const Register from   = c_rarg0;  // source array address
+    const Register to     = c_rarg1;  // destination array address
+    const Register key    = c_rarg2;  // key array address
+    const Register keylen = c_rarg3;
+    const Register rounds = t1;
+
+    const VectorRegister res = v0;
+    const VectorRegister rk  = v1;
+
+    __ enter();
+
+    // keylen is 44, 52 or 60 ints for AES-128, AES-192 and AES-256
+    __ lwu(keylen, Address(key, arrayOopDesc::length_offset_in_bytes() - arrayOopDesc::base_offset_in_bytes(T_INT)));
+
+    __ vsetivli(x0, 4, Assembler::e32, Assembler::m1);
+    __ vle32_v(res, from);
+
+    // round 0: AddRoundKey only
+    __ vle32_v(rk, key);
+    __ vrev8_v(rk, rk);
+    __ vaesz_vs(res, rk);
+    __ addi(key, key, 16);
+
+    // keylen / 4 - 2 middle rounds
+    __ srli(rounds, keylen, 2);
+    __ addi(rounds, rounds, -2);
+    __ bind(L_rounds);
+    __ vle32_v(rk, key);
+    __ vrev8_v(rk, rk);
+    __ vaesem_vv(res, rk);
+    __ addi(key, key, 16);
+    __ addi(rounds, rounds, -1);
+    __ bnez(rounds, L_rounds);
+
+    // final round, no MixColumns
+    __ vle32_v(rk, key);
+    __ vrev8_v(rk, rk);
+    __ vaesef_vv(res, rk);
+
+    __ vse32_v(res, to);
+
+    __ leave();
+    __ ret();
+
+    return start;
+  }
+
   /**
    * int com.sun.crypto.provider.ChaCha20Cipher.implChaCha20Block(int[] initState, byte[] result)
    *
@@ -5716,6 +5782,10 @@ static const int64_t right_3_bits = right_n_bits(3);
     }
 #endif // COMPILER2
 
+    if (UseAESIntrinsics) {
+      StubRoutines::_aescrypt_encryptBlock = generate_aescrypt_encryptBlock();
+    }
+
     if (UseSHA256Intrinsics) {
       Sha2Generator sha2(_masm, this);
       StubRoutines::_sha256_implCompress   = sha2.generate_sha256_implCompress(false);
@@ -188,6 +188,12 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
              range(0, max_jint)                                             \
              constraint(AVX3ThresholdConstraintFunc,AfterErgo)              \
                                                                             \
+  product(size_t, ArrayCopyNonTemporalThreshold, 2621440, DIAGNOSTIC,       \
+             "Minimum copy size in bytes at which AVX512 disjoint array "   \
+             "copies use non-temporal stores. By default half of the "      \
+             "last-level cache size if known, else this value.")            \
+             range(4096, max_jint)                                          \
+                                                                            \
   product(bool, IntelJccErratumMitigation, true, DIAGNOSTIC,                \
              "Turn off JVM mitigations related to Intel micro code "        \
              "mitigations for the Intel JCC erratum")                       \
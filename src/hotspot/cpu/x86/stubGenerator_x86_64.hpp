@@ -318,6 +318,10 @@ class StubGenerator: public StubCodeGenerator {
   address generate_sha256_implCompress(bool multi_block, const char *name);
   address generate_sha512_implCompress(bool multi_block, const char *name);
 
+  // SHA3 stubs
+  void generate_sha3_stubs();
+  address generate_sha3_implCompress(bool multi_block, const char *name);
+
   // Mask for byte-swapping a couple of qwords in an XMM register using (v)pshufb.
   address generate_pshuffle_byte_flip_mask_sha512();
 
@@ -517,7 +517,7 @@ address StubGenerator::generate_disjoint_copy_avx3_masked(address* entry, const
 
   int avx3threshold = VM_Version::avx3_threshold();
   bool use64byteVector = (MaxVectorSize > 32) && (avx3threshold == 0);
-  const int large_threshold = 2621440; // 2.5 MB
+  const int large_threshold = VM_Version::nontemporal_copy_threshold();
   Label L_main_loop, L_main_loop_64bytes, L_tail, L_tail64, L_exit, L_entry;
   Label L_repmovs, L_main_pre_loop, L_main_pre_loop_64bytes, L_pre_main_post_64;
   Label L_copy_large, L_finish;
@@ -752,6 +752,7 @@ void StubGenerator::arraycopy_avx3_large(Register to, Register from, Register te
   Label L_entry_large;
   Label L_main_pre_loop_large;
   Label L_pre_main_post_large;
+  Label L_check_main_large;
 
   assert(MaxVectorSize == 64, "vector length != 64");
   __ BIND(L_entry_large);
@@ -760,7 +761,7 @@ void StubGenerator::arraycopy_avx3_large(Register to, Register from, Register te
   // Partial copy to make dst address 64 byte aligned.
   __ movq(temp2, to);
   __ andq(temp2, 63);
-  __ jcc(Assembler::equal, L_main_pre_loop_large);
+  __ jcc(Assembler::equal, L_check_main_large);
 
   __ negptr(temp2);
   __ addq(temp2, 64);
@@ -773,6 +774,8 @@ void StubGenerator::arraycopy_avx3_large(Register to, Register from, Register te
   __ movq(temp1, count);
   __ subq(temp1, temp2);
 
+  // Enter the main loop only if at least one full iteration remains.
+  __ BIND(L_check_main_large);
   __ cmpq(temp1, loop_size[shift]);
   __ jcc(Assembler::less, L_tail_large);
 
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "asm/assembler.hpp"
+#include "asm/assembler.inline.hpp"
+#include "runtime/stubRoutines.hpp"
+#include "macroAssembler_x86.hpp"
+#include "stubGenerator_x86_64.hpp"
+
+#define __ _masm->
+
+#ifdef PRODUCT
+#define BLOCK_COMMENT(str) /* nothing */
+#else
+#define BLOCK_COMMENT(str) __ block_comment(str)
+#endif // PRODUCT
+
+#define BIND(label) bind(label); BLOCK_COMMENT(#label ":")
+
+// Constants
+
+// Keccak-f[1600] round constants, applied to lane (0,0) by the iota step.
+ATTRIBUTE_ALIGNED(64) static const uint64_t SHA3_ROUND_CONSTS[] = {
+    0x0000000000000001UL, 0x0000000000008082UL, 0x800000000000808AUL,
+    0x8000000080008000UL, 0x000000000000808BUL, 0x0000000080000001UL,
+    0x8000000080008081UL, 0x8000000000008009UL, 0x000000000000008AUL,
+    0x0000000000000088UL, 0x0000000080008009UL, 0x000000008000000AUL,
+    0x000000008000808BUL, 0x800000000000008BUL, 0x8000000000008089UL,
+    0x8000000000008003UL, 0x8000000000008002UL, 0x8000000000000080UL,
+    0x000000000000800AUL, 0x800000008000000AUL, 0x8000000080008081UL,
+    0x8000000000008080UL, 0x0000000080000001UL, 0x8000000080008008UL
+};
+static address sha3_round_consts_addr() {
+  return (address)SHA3_ROUND_CONSTS;
+}
+
+/**
+ * The state is kept as five rows of five lanes, one row per ZMM register
+ * (lanes 5-7 are don't-care).  The first five vectors are the rho
+ * rotation amounts for rows y = 0..4, the last four are vpermq index
+ * vectors that rotate a row left by 1, 2, 3 and 4 lanes, i.e. they
+ * select lane (x + n) % 5 into lane x.
+ */
+ATTRIBUTE_ALIGNED(64) static const uint64_t SHA3_PERM_CONSTS[] = {
+    // rho rotation amounts
+    0,  1, 62, 28, 27, 0, 0, 0,
+   36, 44,  6, 55, 20, 0, 0, 0,
+    3, 10, 43, 25, 39, 0, 0, 0,
+   41, 45, 15, 21,  8, 0, 0, 0,
+   18,  2, 61, 56, 14, 0, 0, 0,
+    // lane rotation indices
+    1,  2,  3,  4,  0, 0, 0, 0,
+    2,  3,  4,  0,  1, 0, 0, 0,
+    3,  4,  0,  1,  2, 0, 0, 0,
+    4,  0,  1,  2,  3, 0, 0, 0
+};
+static address sha3_perm_consts_addr() {
+  return (address)SHA3_PERM_CONSTS;
+}
+
+void StubGenerator::generate_sha3_stubs() {
+  if (UseSHA3Intrinsics) {
+    StubRoutines::_sha3_implCompress   = generate_sha3_implCompress(false, "sha3_implCompress");
+    StubRoutines::_sha3_implCompressMB = generate_sha3_implCompress(true,  "sha3_implCompressMB");
+  }
+}
+
+// Arguments:
+//
+// Inputs:
+//   c_rarg0   - byte[]  source+offset
+//   c_rarg1   - long[]  SHA3.state
+//   c_rarg2   - int     block_size
+//   c_rarg3   - int     offset
+//   c_rarg4   - int     limit
+//
+// Only xmm0-xmm5 and xmm16-xmm31 are used so that nothing has to be
+// preserved on Win64.
+address StubGenerator::generate_sha3_implCompress(bool multi_block, const char *name) {
+  assert(VM_Version::supports_evex(), "requires AVX512F");
+
+  __ align(CodeEntryAlignment);
+  StubCodeMark mark(this, "StubRoutines", name);
+  address start = __ pc();
+
+  const Register buf          = c_rarg0;
+  const Register state        = c_rarg1;
+  const Register block_size   = c_rarg2;
+  const Register ofs          = c_rarg3;
+#ifndef _WIN64
+  const Register limit        = c_rarg4;
+#else
+  const Address limit_mem(rbp, 6 * wordSize); // limit is on stack on Win64
+  const Register limit        = r12;
+#endif
+  const Register consts       = r10;
+  const Register round        = r11;
+  const Register tmp          = rax;
+
+  // state rows A[y][0..4]
+  const XMMRegister A[5] = { xmm0, xmm1, xmm2, xmm3, xmm4 };
+  // rows after pi, also used as theta temporaries
+  const XMMRegister N[5] = { xmm5, xmm16, xmm17, xmm18, xmm19 };
+  const XMMRegister T1 = xmm20;
+  const XMMRegister T2 = xmm21;
+  // rho rotation amounts per row
+  const XMMRegister R[5] = { xmm22, xmm23, xmm24, xmm25, xmm26 };
+  // ROT[n] selects lane (x + n) % 5 into lane x
+  const XMMRegister ROT[5] = { xnoreg, xmm27, xmm28, xmm29, xmm30 };
+
+  // single lane masks for lanes 0..4 and the five lane row mask
+  const KRegister lane[5] = { k1, k2, k3, k4, k5 };
+  const KRegister row_mask = k6;
+
+  Label L_sha3_loop, L_absorb, L_rounds;
+
+  __ enter();
+#ifdef _WIN64
+  __ push(r12);
+  __ movl(limit, limit_mem);
+#endif
+
+  for (int x = 0; x < 5; x++) {
+    __ movl(tmp, 1 << x);
+    __ kmovwl(lane[x], tmp);
+  }
+  __ movl(tmp, 0x1F);
+  __ kmovwl(row_mask, tmp);
+
+  __ lea(consts, ExternalAddress(sha3_perm_consts_addr()));
+  for (int y = 0; y < 5; y++) {
+    __ evmovdquq(R[y], Address(consts, y * 64), Assembler::AVX_512bit);
+  }
+  for (int n = 1; n < 5; n++) {
+    __ evmovdquq(ROT[n], Address(consts, (4 + n) * 64), Assembler::AVX_512bit);
+  }
+
+  __ BIND(L_sha3_loop);
+
+  // Absorb one block: state[i] ^= buf[i] for the block_size / 8 lanes
+  // of the rate, then bring the state into the row registers.
+  __ movl(round, block_size);
+  __ shrl(round, 3);
+  __ BIND(L_absorb);
+  __ movq(tmp, Address(buf, round, Address::times_8, -8));
+  __ xorq(Address(state, round, Address::times_8, -8), tmp);
+  __ decrementl(round);
+  __ jcc(Assembler::notZero, L_absorb);
+
+  for (int y = 0; y < 5; y++) {
+    __ evmovdquq(A[y], row_mask, Address(state, y * 40), false, Assembler::AVX_512bit);
+  }
+
+  __ lea(consts, ExternalAddress(sha3_round_consts_addr()));
+  __ xorl(round, round);
+
+  __ align32();
+  __ BIND(L_rounds);
+
+  // theta: C[x] = A[x,0] ^ ... ^ A[x,4]
+  //        A[x,y] ^= C[x-1] ^ rol(C[x+1], 1)
+  __ evmovdquq(N[0], A[0], Assembler::AVX_512bit);
+  __ vpternlogq(N[0], 0x96, A[1], A[2], Assembler::AVX_512bit);
+  __ vpternlogq(N[0], 0x96, A[3], A[4], Assembler::AVX_512bit);
+  __ evpermq(N[1], row_mask, ROT[4], N[0], false, Assembler::AVX_512bit);
+  __ evpermq(N[2], row_mask, ROT[1], N[0], false, Assembler::AVX_512bit);
+  __ evprolq(N[2], N[2], 1, Assembler::AVX_512bit);
+  for (int y = 0; y < 5; y++) {
+    __ vpternlogq(A[y], 0x96, N[1], N[2], Assembler::AVX_512bit);
+  }
+
+  // rho: A[x,y] = rol(A[x,y], r[x,y])
+  for (int y = 0; y < 5; y++) {
+    __ evprolvq(A[y], A[y], R[y], Assembler::AVX_512bit);
+  }
+
+  // pi: N[x,y] = A[(x + 3y) % 5, x], i.e. lane x of new row y is taken
+  // from lane (x + 3y) % 5 of old row x.
+  for (int y = 0; y < 5; y++) {
+    int n = (3 * y) % 5;
+    for (int x = 0; x < 5; x++) {
+      if (n == 0) {
+        __ evmovdquq(N[y], lane[x], A[x], true, Assembler::AVX_512bit);
+      } else {
+        __ evpermq(N[y], lane[x], ROT[n], A[x], true, Assembler::AVX_512bit);
+      }
+    }
+  }
+
+  // chi: A[x,y] = N[x,y] ^ (~N[x+1,y] & N[x+2,y])
+  for (int y = 0; y < 5; y++) {
+    __ evpermq(T1, row_mask, ROT[1], N[y], false, Assembler::AVX_512bit);
+    __ evpermq(T2, row_mask, ROT[2], N[y], false, Assembler::AVX_512bit);
+    __ evmovdquq(A[y], N[y], Assembler::AVX_512bit);
+    __ vpternlogq(A[y], 0xD2, T1, T2, Assembler::AVX_512bit);
+  }
+
+  // iota: A[0,0] ^= RC[round]; the other lanes of the load are masked
+  // off and do not fault.
+  __ evpxorq(A[0], lane[0], A[0], Address(consts, round, Address::times_8), true, Assembler::AVX_512bit);
+
+  __ incrementl(round);
+  __ cmpl(round, 24);
+  __ jcc(Assembler::less, L_rounds);
+
+  for (int y = 0; y < 5; y++) {
+    __ evmovdquq(Address(state, y * 40), row_mask, A[y], true, Assembler::AVX_512bit);
+  }
+
+  if (multi_block) {
+    __ movl(tmp, block_size);
+    __ addptr(buf, tmp);
+    __ addl(ofs, block_size);
+    __ cmpl(ofs, limit);
+    __ jcc(Assembler::lessEqual, L_sha3_loop);
+    __ movl(rax, ofs); // return ofs
+  }
+
+  __ vzeroupper();
+#ifdef _WIN64
+  __ pop(r12);
+#endif
+  __ leave();
+  __ ret(0);
+
+  return start;
+}
+
+#undef __
@@ -270,7 +270,7 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
     __ bind(std_cpuid4);
     __ movl(rax, 4);
     __ cmpl(rax, Address(rbp, in_bytes(VM_Version::std_cpuid0_offset()))); // Is cpuid(0x4) supported?
-    __ jccb(Assembler::greater, std_cpuid1);
+    __ jcc(Assembler::greater, std_cpuid1);
 
     __ xorl(rcx, rcx);   // L1 cache
     __ cpuid();
@@ -278,7 +278,7 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
     __ andl(rax, 0x1f);  // Determine if valid cache parameters used
     __ orl(rax, rax);    // eax[4:0] == 0 indicates invalid cache
     __ pop(rax);
-    __ jccb(Assembler::equal, std_cpuid1);
+    __ jcc(Assembler::equal, std_cpuid1);
 
     __ lea(rsi, Address(rbp, in_bytes(VM_Version::dcp_cpuid4_offset())));
     __ movl(Address(rsi, 0), rax);
@@ -286,6 +286,25 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
     __ movl(Address(rsi, 8), rcx);
     __ movl(Address(rsi,12), rdx);
 
+    // Walk the remaining cache levels and keep the last valid one,
+    // which describes the last-level cache.
+    for (int level = 1; level <= 3; level++) {
+      __ movl(rax, 4);
+      __ movl(rcx, level);
+      __ cpuid();
+      __ push(rax);
+      __ andl(rax, 0x1f);
+      __ orl(rax, rax);
+      __ pop(rax);
+      __ jcc(Assembler::equal, std_cpuid1);
+
+      __ lea(rsi, Address(rbp, in_bytes(VM_Version::dcp_llc_cpuid4_offset())));
+      __ movl(Address(rsi, 0), rax);
+      __ movl(Address(rsi, 4), rbx);
+      __ movl(Address(rsi, 8), rcx);
+      __ movl(Address(rsi,12), rdx);
+    }
+
     //
     // Standard cpuid(0x1)
     //
@@ -1309,12 +1328,17 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseSHA512Intrinsics, false);
   }
 
-  if (UseSHA3Intrinsics) {
+  // These are only supported on 64-bit and need AVX-512; there is no AVX2
+  // variant. The stub is not enabled by default until
+  // compiler/intrinsics/sha/TestSHA3Intrinsic has run on AVX-512 hardware,
+  // it has to be requested with -XX:+UseSHA3Intrinsics.
+  const bool sha3_supported = LP64_ONLY(UseSHA && supports_evex()) NOT_LP64(false);
+  if (UseSHA3Intrinsics && !sha3_supported) {
     warning("Intrinsics for SHA3-224, SHA3-256, SHA3-384 and SHA3-512 crypto hash functions not available on this CPU.");
     FLAG_SET_DEFAULT(UseSHA3Intrinsics, false);
   }
 
-  if (!(UseSHA1Intrinsics || UseSHA256Intrinsics || UseSHA512Intrinsics)) {
+  if (!(UseSHA1Intrinsics || UseSHA256Intrinsics || UseSHA512Intrinsics || UseSHA3Intrinsics)) {
     FLAG_SET_DEFAULT(UseSHA, false);
   }
 
@@ -2166,6 +2190,23 @@ int VM_Version::avx3_threshold() {
           FLAG_IS_DEFAULT(AVX3Threshold)) ? 0 : AVX3Threshold;
 }
 
+// nontemporal_copy_threshold() is the copy size in bytes at and above which
+// the AVX-512 disjoint array copy stubs bypass the cache with non-temporal
+// stores. Unless set explicitly it is half of the last-level cache, so a
+// single large copy cannot flush the cache shared with other threads.
+int VM_Version::nontemporal_copy_threshold() {
+  size_t threshold = ArrayCopyNonTemporalThreshold;
+  if (FLAG_IS_DEFAULT(ArrayCopyNonTemporalThreshold)) {
+    size_t llc_size = last_level_cache_size();
+    if (llc_size != 0) {
+      threshold = llc_size / 2;
+    }
+  }
+  // Never go below a page, the large copy loop is not meant for short copies.
+  threshold = MAX2(threshold, (size_t)os::vm_page_size());
+  return (int)MIN2(threshold, (size_t)max_jint);
+}
+
 #if defined(_LP64)
 void VM_Version::clear_apx_test_state() {
   clear_apx_test_state_stub();
@@ -3239,6 +3280,20 @@ uint VM_Version::threads_per_core() {
   return (result == 0 ? 1 : result);
 }
 
+size_t VM_Version::last_level_cache_size() {
+  // Only cpuid(0x4) is consulted, which is not implemented by AMD.
+  if (!is_intel() && !is_zx()) {
+    return 0;
+  }
+  if (_cpuid_info.dcp_llc_cpuid4_eax.bits.cache_type == 0) {
+    return 0;
+  }
+  DcpCpuid4Ebx ebx = _cpuid_info.dcp_llc_cpuid4_ebx;
+  size_t sets = (size_t)_cpuid_info.dcp_llc_cpuid4_ecx + 1;
+  return (size_t)(ebx.bits.associativity + 1) * (ebx.bits.partitions + 1) *
+         (ebx.bits.L1_line_size + 1) * sets;
+}
+
 uint VM_Version::L1_line_size() {
   uint result = 0;
   if (is_intel()) {
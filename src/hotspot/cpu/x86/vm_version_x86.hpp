@@ -473,6 +473,12 @@ class VM_Version : public Abstract_VM_Version {
     uint32_t     dcp_cpuid4_ecx; // unused currently
     uint32_t     dcp_cpuid4_edx; // unused currently
 
+    // cpuid function 4, last valid cache level (last-level cache)
+    DcpCpuid4Eax dcp_llc_cpuid4_eax;
+    DcpCpuid4Ebx dcp_llc_cpuid4_ebx;
+    uint32_t     dcp_llc_cpuid4_ecx; // number of sets - 1
+    uint32_t     dcp_llc_cpuid4_edx; // unused currently
+
     // cpuid function 7 (structured extended features enumeration leaf)
     // eax = 7, ecx = 0
     SefCpuid7Eax sef_cpuid7_eax;
@@ -605,6 +611,7 @@ class VM_Version : public Abstract_VM_Version {
   static ByteSize std_cpuid0_offset() { return byte_offset_of(CpuidInfo, std_max_function); }
   static ByteSize std_cpuid1_offset() { return byte_offset_of(CpuidInfo, std_cpuid1_eax); }
   static ByteSize dcp_cpuid4_offset() { return byte_offset_of(CpuidInfo, dcp_cpuid4_eax); }
+  static ByteSize dcp_llc_cpuid4_offset() { return byte_offset_of(CpuidInfo, dcp_llc_cpuid4_eax); }
   static ByteSize sef_cpuid7_offset() { return byte_offset_of(CpuidInfo, sef_cpuid7_eax); }
   static ByteSize sefsl1_cpuid7_offset() { return byte_offset_of(CpuidInfo, sefsl1_cpuid7_eax); }
   static ByteSize ext_cpuid1_offset() { return byte_offset_of(CpuidInfo, ext_cpuid1_eax); }
@@ -686,6 +693,8 @@ class VM_Version : public Abstract_VM_Version {
 
   static uint cores_per_cpu();
   static uint threads_per_core();
+  // Size in bytes of the last-level cache, 0 if unknown
+  static size_t last_level_cache_size();
   static uint L1_line_size();
 
   static uint prefetch_data_size()  {
@@ -779,6 +788,8 @@ class VM_Version : public Abstract_VM_Version {
 
   static int avx3_threshold();
 
+  static int nontemporal_copy_threshold();
+
   static bool is_intel_tsc_synched_at_init();
 
   // This checks if the JVM is potentially affected by an erratum on Intel CPUs (SKX102)
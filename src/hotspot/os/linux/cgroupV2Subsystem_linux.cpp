@@ -264,12 +264,41 @@ jlong memory_swap_limit_value(CgroupV2Controller* ctrl) {
   return swap_limit;
 }
 
+// memory.high : throttling limit; the cgroup gets reclaimed and slowed down above it
+static
+jlong memory_high_limit_value(CgroupV2Controller* ctrl) {
+  jlong memory_high;
+  CONTAINER_READ_NUMBER_CHECKED_MAX(ctrl, "/memory.high", "Memory High Limit", memory_high);
+  return memory_high;
+}
+
+// memory.events high : number of times the cgroup was throttled for exceeding memory.high
+static
+jlong memory_high_events_value(CgroupV2Controller* ctrl) {
+  julong high_events;
+  bool is_ok = ctrl->read_numerical_key_value("/memory.events", "high", &high_events);
+  if (!is_ok) {
+    return OSCONTAINER_ERROR;
+  }
+  log_trace(os, container)("Memory High Events is: " JULONG_FORMAT, high_events);
+  return (jlong)high_events;
+}
+
 void CgroupV2MemoryController::print_version_specific_info(outputStream* st, julong phys_mem) {
   jlong swap_current = memory_swap_current_value(reader());
   jlong swap_limit = memory_swap_limit_value(reader());
+  jlong memory_high = memory_high_limit_value(reader());
+  jlong high_events = memory_high_events_value(reader());
 
   OSContainer::print_container_helper(st, swap_current, "memory_swap_current_in_bytes");
   OSContainer::print_container_helper(st, swap_limit, "memory_swap_max_limit_in_bytes");
+  OSContainer::print_container_helper(st, memory_high, "memory_high_limit_in_bytes");
+  st->print("memory_high_events: ");
+  if (high_events >= 0) {
+    st->print_cr(JLONG_FORMAT, high_events);
+  } else {
+    st->print_cr("not supported");
+  }
 }
 
 char* CgroupV2Controller::construct_path(char* mount_path, char *cgroup_path) {
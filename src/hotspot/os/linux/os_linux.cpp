@@ -5137,14 +5137,18 @@ static jlong slow_thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   char cdummy;
   int idummy;
   long ldummy;
-  FILE *fp;
 
+  // Read the stat file with a single read(2) rather than through stdio: this
+  // is called once per thread by bulk ThreadMXBean queries, and fopen would
+  // allocate and lock a FILE buffer for every call.
   snprintf(proc_name, 64, "/proc/self/task/%d/stat", tid);
-  fp = os::fopen(proc_name, "r");
-  if (fp == nullptr) return -1;
-  statlen = fread(stat, 1, 2047, fp);
+  int fd = ::open(proc_name, O_RDONLY | O_CLOEXEC);
+  if (fd == -1) return -1;
+  ssize_t ret = ::read(fd, stat, sizeof(stat) - 1);
+  ::close(fd);
+  if (ret <= 0) return -1;
+  statlen = (size_t)ret;
   stat[statlen] = '\0';
-  fclose(fp);
 
   // Skip pid and the command string. Note that we could be dealing with
   // weird command names, e.g. user could decide to rename java launcher
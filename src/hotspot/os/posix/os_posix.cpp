@@ -1851,6 +1851,15 @@ void Parker::park(bool isAbsolute, jlong time) {
 }
 
 void Parker::unpark() {
+  // Optional fast-path check:
+  // If a permit is already available there is nothing to do, and the
+  // parker cannot be blocked on a condvar since it only waits with
+  // _counter == 0 under the mutex.  The fence orders the caller's prior
+  // stores before the read of _counter, pairing with the full barrier of
+  // the Atomic::xchg() in park() that consumes the permit.
+  OrderAccess::fence();
+  if (Atomic::load(&_counter) > 0) return;
+
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "invariant");
   const int s = _counter;
@@ -256,6 +256,38 @@ class ArchiveHeapLoader::PatchLoadedRegionPointers: public BitMapClosure {
   }
 };
 
+// When the dumptime and runtime shifts are the same, all pointers in the loaded
+// region can be relocated by adding a single delta to the narrowOop value.
+class ArchiveHeapLoader::PatchLoadedRegionPointersQuick: public BitMapClosure {
+  narrowOop* _start;
+  uint32_t _delta;
+  DEBUG_ONLY(intx _offset;)
+
+ public:
+  PatchLoadedRegionPointersQuick(narrowOop* start, uint32_t delta, LoadedArchiveHeapRegion* loaded_region)
+    : _start(start),
+      _delta(delta)
+      DEBUG_ONLY(COMMA _offset(loaded_region->_runtime_offset)) {}
+
+  bool do_bit(size_t offset) {
+    narrowOop* p = _start + offset;
+    narrowOop v = *p;
+    assert(!CompressedOops::is_null(v), "null oops should have been filtered out at dump time");
+    narrowOop new_v = CompressedOops::narrow_oop_cast(CompressedOops::narrow_oop_value(v) + _delta);
+    assert(!CompressedOops::is_null(new_v), "should never relocate to narrowOop(0)");
+#ifdef ASSERT
+    // The loaded heap relocation is not initialized yet, so decode_from_archive()
+    // still returns the dumptime address.
+    uintptr_t o1 = cast_from_oop<uintptr_t>(ArchiveHeapLoader::decode_from_archive(v)) + _offset;
+    uintptr_t o2 = cast_from_oop<uintptr_t>(CompressedOops::decode_not_null(new_v));
+    assert(o1 == o2, "quick delta must work");
+    ArchiveHeapLoader::assert_in_loaded_heap(o2);
+#endif
+    RawAccess<IS_NOT_NULL>::oop_store(p, new_v);
+    return true;
+  }
+};
+
 bool ArchiveHeapLoader::init_loaded_region(FileMapInfo* mapinfo, LoadedArchiveHeapRegion* loaded_region,
                                            MemRegion& archive_space) {
   size_t total_bytes = 0;
@@ -312,8 +344,18 @@ bool ArchiveHeapLoader::load_heap_region_impl(FileMapInfo* mapinfo, LoadedArchiv
   uintptr_t oopmap = bitmap_base + r->oopmap_offset();
   BitMapView bm((BitMap::bm_word_t*)oopmap, r->oopmap_size_in_bits());
 
-  PatchLoadedRegionPointers patcher((narrowOop*)load_address + FileMapInfo::current_info()->heap_oopmap_start_pos(), loaded_region);
-  bm.iterate(&patcher);
+  narrowOop* patching_start = (narrowOop*)load_address + FileMapInfo::current_info()->heap_oopmap_start_pos();
+  if (_narrow_oop_shift == CompressedOops::shift()) {
+    uint32_t dt_encoded_bottom = (uint32_t)((loaded_region->_dumptime_base - (uintptr_t)_narrow_oop_base) >> _narrow_oop_shift);
+    uint32_t rt_encoded_bottom = CompressedOops::narrow_oop_value(CompressedOops::encode_not_null(cast_to_oop(load_address)));
+    uint32_t quick_delta = rt_encoded_bottom - dt_encoded_bottom;
+    log_info(cds)("CDS heap data relocation quick delta = 0x%x", quick_delta);
+    PatchLoadedRegionPointersQuick patcher(patching_start, quick_delta, loaded_region);
+    bm.iterate(&patcher);
+  } else {
+    PatchLoadedRegionPointers patcher(patching_start, loaded_region);
+    bm.iterate(&patcher);
+  }
   return true;
 }
 
@@ -1358,15 +1358,18 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method
   }
 }
 
-void CodeCache::make_marked_nmethods_deoptimized() {
+int CodeCache::make_marked_nmethods_deoptimized() {
+  int count = 0;
   RelaxedNMethodIterator iter(RelaxedNMethodIterator::not_unloading);
   while(iter.next()) {
     nmethod* nm = iter.method();
     if (nm->is_marked_for_deoptimization() && !nm->has_been_deoptimized() && nm->can_be_deoptimized()) {
       nm->make_not_entrant();
       nm->make_deoptimized();
+      count++;
     }
   }
+  return count;
 }
 
 // Marks compiled methods dependent on dependee.
@@ -1734,6 +1737,13 @@ void CodeCache::print_summary(outputStream* st, bool detailed) {
                    p2i(heap->low_boundary()),
                    p2i(heap->high()),
                    p2i(heap->high_boundary()));
+      if (CodeCache_lock->owned_by_self()) {
+        // Walking the free list is only safe while the heap cannot change.
+        st->print_cr(" free list blocks=%d, free list size=" SIZE_FORMAT "Kb, largest free block=" SIZE_FORMAT "Kb",
+                     heap->freelist_length(),
+                     heap->allocated_in_freelist()/K,
+                     heap->largest_free_block()/K);
+      }
 
       full_count += get_codemem_full_count(heap->code_blob_type());
     }
@@ -293,7 +293,7 @@ class CodeCache : AllStatic {
  public:
   static void mark_all_nmethods_for_deoptimization(DeoptimizationScope* deopt_scope);
   static void mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method* dependee);
-  static void make_marked_nmethods_deoptimized();
+  static int make_marked_nmethods_deoptimized(); // returns the number of nmethods deoptimized
 
   // Marks dependents during classloading
   static void mark_dependents_on(DeoptimizationScope* deopt_scope, InstanceKlass* dependee);
@@ -622,7 +622,10 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = nullptr;
   CompileTask *max_task = nullptr;
   Method* max_method = nullptr;
+  // Weight of max_method, cached so that each queued task is weighed only once.
+  double max_weight = 0.0;
 
+  Thread* current = Thread::current();
   jlong t = nanos_to_millis(os::javaTimeNanos());
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != nullptr;) {
@@ -635,7 +638,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     Method* method = task->method();
-    methodHandle mh(Thread::current(), method);
+    methodHandle mh(current, method);
     if (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, mh) && !is_old(mh)) {
       if (PrintTieredEvents) {
         print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
@@ -646,10 +649,14 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       continue;
     }
     update_rate(t, mh);
-    if (max_task == nullptr || compare_methods(method, max_method)) {
-      // Select a method with the highest rate
+    double w = weight(method);
+    if (max_task == nullptr ||
+        method->highest_comp_level() > max_method->highest_comp_level() ||
+        (method->highest_comp_level() == max_method->highest_comp_level() && w > max_weight)) {
+      // Select a method with the highest rate, see compare_methods()
       max_task = task;
       max_method = method;
+      max_weight = w;
     }
 
     if (task->is_blocking()) {
@@ -671,7 +678,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
     max_method = max_task->method();
   }
 
-  methodHandle max_method_h(Thread::current(), max_method);
+  methodHandle max_method_h(current, max_method);
 
   if (max_task != nullptr && max_task->comp_level() == CompLevel_full_profile && TieredStopAtLevel > CompLevel_full_profile &&
       max_method != nullptr && is_method_profiled(max_method_h) && !Arguments::is_compiler_only()) {
@@ -54,6 +54,7 @@
 #include "prims/nativeLookup.hpp"
 #include "prims/whitebox.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/cpuTimeCounters.hpp"
 #include "runtime/escapeBarrier.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
@@ -68,6 +69,7 @@
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/timerTrace.hpp"
 #include "runtime/vframe.inline.hpp"
 #include "utilities/debug.hpp"
@@ -446,6 +448,10 @@ CompileTask* CompileQueue::get(CompilerThread* thread) {
     save_hot_method = methodHandle(thread, task->hot_method());
 
     remove(task);
+    log_debug(jit, compilation)("%s dequeued task %d (tier %d) after %.3f ms in queue, %d tasks remaining",
+                                name(), task->compile_id(), task->comp_level(),
+                                TimeHelper::counter_to_millis(os::elapsed_counter() - task->time_queued()),
+                                size());
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
   return task;
@@ -669,6 +675,13 @@ void CompileBroker::compilation_init(JavaThread* THREAD) {
     CompilationMemoryStatistic::initialize();
   }
 
+  if (_c1_count > 0) {
+    CPUTimeCounters::create_counter(CPUTimeGroups::CPUTimeType::compiler_c1);
+  }
+  if (_c2_count > 0) {
+    CPUTimeCounters::create_counter(CPUTimeGroups::CPUTimeType::compiler_c2);
+  }
+
   // Start the compiler thread(s)
   init_compiler_threads();
   // totalTime performance counter is always created as it is required
@@ -1877,6 +1890,18 @@ CompileLog* CompileBroker::get_log(CompilerThread* ct) {
   return log;
 }
 
+// Add the CPU time a compiler thread spent on one task to the hsperfdata
+// counter of its compiler. The JVMCI compiler shares the C2 queue and is
+// accounted as compiler_c2.
+static void publish_compiler_cpu_time(CompilerThread* thread, jlong cpu_time) {
+  CPUTimeGroups::CPUTimeType type = thread->compiler()->is_c1() ?
+                                      CPUTimeGroups::CPUTimeType::compiler_c1 :
+                                      CPUTimeGroups::CPUTimeType::compiler_c2;
+  // Compiler threads update the counters concurrently.
+  MutexLocker locker(CompileStatistics_lock);
+  CPUTimeCounters::get_counter(type)->inc(cpu_time);
+}
+
 // ------------------------------------------------------------------
 // CompileBroker::compiler_thread_loop
 //
@@ -1958,7 +1983,12 @@ void CompileBroker::compiler_thread_loop() {
       if (method()->number_of_breakpoints() == 0) {
         // Compile the method.
         if ((UseCompiler || AlwaysCompileLoopMethods) && CompileBroker::should_compile_new_jobs()) {
+          const bool track_cpu_time = UsePerfData && os::is_thread_cpu_time_supported();
+          const jlong cpu_start = track_cpu_time ? os::current_thread_cpu_time() : 0;
           invoke_compiler_on_method(task);
+          if (track_cpu_time) {
+            publish_compiler_cpu_time(thread, os::current_thread_cpu_time() - cpu_start);
+          }
           thread->start_idle_timer();
         } else {
           // After compilation is disabled, remove remaining methods from queue
@@ -73,6 +73,7 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _concurrent_mark_remark_times_ms(NumPrevPausesForHeuristics),
     _concurrent_mark_cleanup_times_ms(NumPrevPausesForHeuristics),
     _alloc_rate_ms_seq(TruncatedSeqLength),
+    _alloc_rate_ms_trend_seq(G1AllocationRateForecastAlpha, G1AllocationRateForecastBeta),
     _prev_collection_pause_end_ms(0.0),
     _concurrent_refine_rate_ms_seq(TruncatedSeqLength),
     _dirtied_cards_rate_ms_seq(TruncatedSeqLength),
@@ -156,6 +157,7 @@ void G1Analytics::report_concurrent_mark_remark_times_ms(double ms) {
 
 void G1Analytics::report_alloc_rate_ms(double alloc_rate) {
   _alloc_rate_ms_seq.add(alloc_rate);
+  _alloc_rate_ms_trend_seq.add(alloc_rate);
 }
 
 void G1Analytics::compute_pause_time_ratios(double end_time_sec, double pause_time_ms) {
@@ -227,12 +229,21 @@ void G1Analytics::report_code_root_rs_length(double code_root_rs_length, bool fo
 
 double G1Analytics::predict_alloc_rate_ms() const {
   if (enough_samples_available(&_alloc_rate_ms_seq)) {
-    return predict_zero_bounded(&_alloc_rate_ms_seq);
+    double prediction = predict_zero_bounded(&_alloc_rate_ms_seq);
+    if (G1UseAllocationRateForecast) {
+      // Size for a rising allocation rate before it shows up in the average.
+      prediction = MAX2(prediction, forecast_alloc_rate_ms());
+    }
+    return prediction;
   } else {
     return 0.0;
   }
 }
 
+double G1Analytics::forecast_alloc_rate_ms() const {
+  return _alloc_rate_ms_trend_seq.forecast();
+}
+
 double G1Analytics::predict_concurrent_refine_rate_ms() const {
   return predict_zero_bounded(&_concurrent_refine_rate_ms_seq);
 }
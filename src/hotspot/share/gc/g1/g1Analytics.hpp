@@ -44,6 +44,8 @@ class G1Analytics: public CHeapObj<mtGC> {
   TruncatedSeq _concurrent_mark_cleanup_times_ms;
 
   TruncatedSeq _alloc_rate_ms_seq;
+  // Trend of the allocation rate used to anticipate allocation bursts.
+  G1TrendSeq    _alloc_rate_ms_trend_seq;
   double        _prev_collection_pause_end_ms;
 
   TruncatedSeq _concurrent_refine_rate_ms_seq;
@@ -141,6 +143,8 @@ class G1Analytics: public CHeapObj<mtGC> {
   void report_code_root_rs_length(double code_root_rs_length, bool for_young_only_phase);
 
   double predict_alloc_rate_ms() const;
+  // Forecast of the allocation rate until the next pause based on its recent trend.
+  double forecast_alloc_rate_ms() const;
   int num_alloc_rate_ms() const;
 
   double predict_concurrent_refine_rate_ms() const;
@@ -52,4 +52,31 @@ class G1PhaseDependentSeq {
   double predict(const G1Predictions* predictor, bool use_young_only_phase_seq) const;
 };
 
+// Double exponential smoothing (Holt's linear trend method) of a sequence of
+// samples. In addition to the smoothed level of the samples it tracks their
+// smoothed trend, so that forecast() anticipates a sustained increase (or
+// decrease) of the values instead of lagging behind like a decaying average.
+class G1TrendSeq {
+  const double _level_alpha;
+  const double _trend_beta;
+
+  double _level;
+  double _trend;
+  uint _num;
+
+  NONCOPYABLE(G1TrendSeq);
+
+public:
+  G1TrendSeq(double level_alpha, double trend_beta);
+
+  void add(double value);
+
+  uint num() const { return _num; }
+  double level() const { return _level; }
+  double trend() const { return _trend; }
+
+  // Forecast of the value the given number of samples ahead, bounded by zero.
+  double forecast(uint steps_ahead = 1) const;
+};
+
 #endif /* SHARE_GC_G1_G1ANALYTICSSEQUENCES_HPP */
@@ -57,4 +57,27 @@ double G1PhaseDependentSeq::predict(const G1Predictions* predictor, bool use_you
   }
 }
 
+G1TrendSeq::G1TrendSeq(double level_alpha, double trend_beta) :
+  _level_alpha(level_alpha),
+  _trend_beta(trend_beta),
+  _level(0.0),
+  _trend(0.0),
+  _num(0)
+{ }
+
+void G1TrendSeq::add(double value) {
+  if (_num == 0) {
+    _level = value;
+  } else {
+    double prev_level = _level;
+    _level = _level_alpha * value + (1.0 - _level_alpha) * (_level + _trend);
+    _trend = _trend_beta * (_level - prev_level) + (1.0 - _trend_beta) * _trend;
+  }
+  _num++;
+}
+
+double G1TrendSeq::forecast(uint steps_ahead) const {
+  return MAX2(_level + steps_ahead * _trend, 0.0);
+}
+
 #endif /* SHARE_GC_G1_G1ANALYTICSSEQUENCES_INLINE_HPP */
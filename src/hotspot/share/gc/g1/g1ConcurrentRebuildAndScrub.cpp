@@ -26,16 +26,19 @@
 
 #include "gc/g1/g1ConcurrentRebuildAndScrub.hpp"
 
+#include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1ConcurrentMark.inline.hpp"
 #include "gc/g1/g1ConcurrentMarkBitMap.inline.hpp"
 #include "gc/g1/g1HeapRegion.inline.hpp"
 #include "gc/g1/g1HeapRegionManager.inline.hpp"
+#include "gc/g1/g1Policy.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "memory/memRegion.hpp"
 #include "oops/oopsHierarchy.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -61,12 +64,20 @@
 // we need to scan objects to rebuild remembered sets until tars.
 // Regions might have been reclaimed while scrubbing them after having yielded for
 // a pause.
+//
+// The collection set candidates selected during the Remark pause are processed
+// first, in decreasing order of gc efficiency, so that the remembered sets of the
+// regions that are most profitable to collect are complete as early as possible.
+// All other regions are processed in address order afterwards.
 class G1RebuildRSAndScrubTask : public WorkerTask {
   G1ConcurrentMark* _cm;
   HeapRegionClaimer _hr_claimer;
 
   const bool _should_rebuild_remset;
 
+  G1CollectionCandidateList* _priority_regions;
+  volatile uint _next_priority_region;
+
   class G1RebuildRSAndScrubRegionClosure : public HeapRegionClosure {
     G1ConcurrentMark* _cm;
     const G1CMBitMap* _bitmap;
@@ -331,13 +342,39 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
     WorkerTask("Scrub dead objects"),
     _cm(cm),
     _hr_claimer(num_workers),
-    _should_rebuild_remset(should_rebuild_remset) { }
+    _should_rebuild_remset(should_rebuild_remset),
+    _priority_regions(&G1CollectedHeap::heap()->policy()->candidates()->marking_regions()),
+    _next_priority_region(0) { }
+
+  // Claims and processes the collection set candidates in the order of the candidate
+  // list. Claimed regions are skipped by the following iteration over the whole heap.
+  // Returns whether the concurrent marking cycle has been aborted.
+  bool process_priority_regions(HeapRegionClosure* cl) {
+    while (true) {
+      uint idx = Atomic::fetch_then_add(&_next_priority_region, 1u);
+      // The candidate list may only change during a pause we yielded to, so
+      // always check against its current length.
+      if (idx >= _priority_regions->length()) {
+        return false;
+      }
+      G1HeapRegion* hr = _priority_regions->at(idx)._r;
+      if (!_hr_claimer.claim_region(hr->hrm_index())) {
+        continue;
+      }
+      if (cl->do_heap_region(hr)) {
+        return true;
+      }
+    }
+  }
 
   void work(uint worker_id) {
     SuspendibleThreadSetJoiner sts_join;
 
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
     G1RebuildRSAndScrubRegionClosure cl(_cm, _should_rebuild_remset, worker_id);
+    if (process_priority_regions(&cl)) {
+      return;
+    }
     g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
   }
 };
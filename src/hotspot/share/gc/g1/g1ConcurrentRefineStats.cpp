@@ -28,6 +28,7 @@
 G1ConcurrentRefineStats::G1ConcurrentRefineStats() :
   _refinement_time(),
   _refined_cards(0),
+  _refined_buffers(0),
   _precleaned_cards(0),
   _dirtied_cards(0)
 {}
@@ -38,10 +39,15 @@ double G1ConcurrentRefineStats::refinement_rate_ms() const {
   return (secs > 0) ? (refined_cards() / (secs * MILLIUNITS)) : 0.0;
 }
 
+double G1ConcurrentRefineStats::cards_per_buffer() const {
+  return (refined_buffers() > 0) ? ((double)refined_cards() / refined_buffers()) : 0.0;
+}
+
 G1ConcurrentRefineStats&
 G1ConcurrentRefineStats::operator+=(const G1ConcurrentRefineStats& other) {
   _refinement_time += other._refinement_time;
   _refined_cards += other._refined_cards;
+  _refined_buffers += other._refined_buffers;
   _precleaned_cards += other._precleaned_cards;
   _dirtied_cards += other._dirtied_cards;
   return *this;
@@ -56,6 +62,7 @@ G1ConcurrentRefineStats&
 G1ConcurrentRefineStats::operator-=(const G1ConcurrentRefineStats& other) {
   _refinement_time = clipped_sub(_refinement_time, other._refinement_time);
   _refined_cards = clipped_sub(_refined_cards, other._refined_cards);
+  _refined_buffers = clipped_sub(_refined_buffers, other._refined_buffers);
   _precleaned_cards = clipped_sub(_precleaned_cards, other._precleaned_cards);
   _dirtied_cards = clipped_sub(_dirtied_cards, other._dirtied_cards);
   return *this;
@@ -35,6 +35,7 @@
 class G1ConcurrentRefineStats : public CHeapObj<mtGC> {
   Tickspan _refinement_time;
   size_t _refined_cards;
+  size_t _refined_buffers;
   size_t _precleaned_cards;
   size_t _dirtied_cards;
 
@@ -50,6 +51,12 @@ class G1ConcurrentRefineStats : public CHeapObj<mtGC> {
   // Refinement rate, in cards per ms.
   double refinement_rate_ms() const;
 
+  // Number of card buffers processed; buffers are refined as a batch.
+  size_t refined_buffers() const { return _refined_buffers; }
+
+  // Average number of cards processed per refined buffer.
+  double cards_per_buffer() const;
+
   // Number of cards for which refinement was skipped because some other
   // thread had already refined them.
   size_t precleaned_cards() const { return _precleaned_cards; }
@@ -59,6 +66,7 @@ class G1ConcurrentRefineStats : public CHeapObj<mtGC> {
 
   void inc_refinement_time(Tickspan t) { _refinement_time += t; }
   void inc_refined_cards(size_t cards) { _refined_cards += cards; }
+  void inc_refined_buffers() { _refined_buffers++; }
   void inc_precleaned_cards(size_t cards) { _precleaned_cards += cards; }
   void inc_dirtied_cards(size_t cards) { _dirtied_cards += cards; }
 
@@ -459,6 +459,7 @@ bool G1DirtyCardQueueSet::refine_buffer(BufferNode* node,
   G1RefineBufferedCards buffered_cards(node, worker_id, stats);
   bool result = buffered_cards.refine();
   stats->inc_refinement_time(Ticks::now() - start_time);
+  stats->inc_refined_buffers();
   return result;
 }
 
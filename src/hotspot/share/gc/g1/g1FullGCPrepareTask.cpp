@@ -38,10 +38,19 @@
 #include "oops/oop.inline.hpp"
 #include "utilities/ticks.hpp"
 
+static uint compaction_budget(G1CollectedHeap* g1h, G1FullCollector* collector) {
+  if (collector->scope()->do_maximal_compaction() || G1FullGCPartialCompactionPercent == 100) {
+    return UINT_MAX;
+  }
+  uint budget = (uint)((size_t)g1h->num_regions() * G1FullGCPartialCompactionPercent / 100);
+  return MAX2(budget, 1u);
+}
+
 G1DetermineCompactionQueueClosure::G1DetermineCompactionQueueClosure(G1FullCollector* collector) :
   _g1h(G1CollectedHeap::heap()),
   _collector(collector),
-  _cur_worker(0) { }
+  _cur_worker(0),
+  _remaining_compaction_budget(compaction_budget(_g1h, collector)) { }
 
 bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(G1HeapRegion* hr) {
   uint region_idx = hr->hrm_index();
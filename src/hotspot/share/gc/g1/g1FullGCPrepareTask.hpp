@@ -41,10 +41,16 @@ class G1DetermineCompactionQueueClosure : public HeapRegionClosure {
   G1CollectedHeap* _g1h;
   G1FullCollector* _collector;
   uint _cur_worker;
+  // Number of regions containing live objects that may still be added to
+  // the compaction queues, see G1FullGCPartialCompactionPercent.
+  uint _remaining_compaction_budget;
 
   inline void free_empty_humongous_region(G1HeapRegion* hr);
 
   inline bool should_compact(G1HeapRegion* hr) const;
+  // Consumes compaction budget for a region that should be compacted.
+  // Returns false if the region must be left in place instead.
+  inline bool claim_compaction_budget(G1HeapRegion* hr);
 
   // Returns the current worker id to assign a compaction point to, and selects
   // the next one round-robin style.
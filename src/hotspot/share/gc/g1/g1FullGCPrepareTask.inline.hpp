@@ -51,6 +51,21 @@ inline bool G1DetermineCompactionQueueClosure::should_compact(G1HeapRegion* hr)
   return live_words <= live_words_threshold;
 }
 
+inline bool G1DetermineCompactionQueueClosure::claim_compaction_budget(G1HeapRegion* hr) {
+  if (_remaining_compaction_budget == UINT_MAX) {
+    return true;
+  }
+  // Regions without live objects are cheap to compact and only provide space.
+  if (_collector->live_words(hr->hrm_index()) == 0) {
+    return true;
+  }
+  if (_remaining_compaction_budget == 0) {
+    return false;
+  }
+  _remaining_compaction_budget--;
+  return true;
+}
+
 inline uint G1DetermineCompactionQueueClosure::next_worker() {
   uint result = _cur_worker;
   _cur_worker = (_cur_worker + 1) % _collector->workers();
@@ -79,7 +94,7 @@ static bool has_pinned_objects(G1HeapRegion* hr) {
 }
 
 inline bool G1DetermineCompactionQueueClosure::do_heap_region(G1HeapRegion* hr) {
-  if (should_compact(hr)) {
+  if (should_compact(hr) && claim_compaction_budget(hr)) {
     assert(!hr->is_humongous(), "moving humongous objects not supported.");
     add_to_compaction_queue(hr);
     return false;
@@ -101,10 +116,12 @@ inline bool G1DetermineCompactionQueueClosure::do_heap_region(G1HeapRegion* hr)
       _collector->set_has_humongous();
     }
   } else {
-    assert(MarkSweepDeadRatio > 0,
-           "only skip compaction for other regions when MarkSweepDeadRatio > 0");
+    assert(MarkSweepDeadRatio > 0 || G1FullGCPartialCompactionPercent < 100,
+           "only skip compaction for other regions when MarkSweepDeadRatio > 0 "
+           "or compacting only part of the heap");
 
-    // Too many live objects in the region; skip compacting it.
+    // Too many live objects in the region or compaction budget exhausted;
+    // skip compacting it.
     _collector->update_from_compacting_to_skip_compacting(hr->hrm_index());
     log_trace(gc, phases)("Phase 2: skip compaction region index: %u, live words: " SIZE_FORMAT,
                             hr->hrm_index(), _collector->live_words(hr->hrm_index()));
@@ -466,8 +466,18 @@ uint HeapRegionManager::find_contiguous_in_range(uint start, uint end, uint num_
 }
 
 uint HeapRegionManager::find_contiguous_in_free_list(uint num_regions) {
+  // Check if we can actually satisfy the allocation.
+  if (num_regions > _free_list.length()) {
+    return G1_NO_HRM_INDEX;
+  }
+  // A sequence of free regions can not start below the first region of the
+  // (ordered) free list, so there is no need to walk over all the allocated
+  // regions in front of it.
+  G1HeapRegion* first_free = _free_list.first();
+  assert(first_free != nullptr, "must be");
+
   uint candidate = G1_NO_HRM_INDEX;
-  HeapRegionRange range(0,0);
+  HeapRegionRange range(first_free->hrm_index(), first_free->hrm_index());
 
   do {
     range = _committed_map.next_active_range(range.end());
@@ -213,6 +213,9 @@ class FreeRegionList : public HeapRegionSetBase {
   // Removes from head or tail based on the given argument.
   G1HeapRegion* remove_region(bool from_head);
 
+  // Returns the region with the lowest index in the list, or null if the list is empty.
+  G1HeapRegion* first() const { return _head; }
+
   G1HeapRegion* remove_region_with_node_index(bool from_head,
                                             uint requested_node_index);
 
@@ -202,11 +202,16 @@ class G1RootRegionScanClosure : public ClaimMetadataVisitingOopIterateClosure {
 class G1ConcurrentRefineOopClosure: public BasicOopIterateClosure {
   G1CollectedHeap* _g1h;
   uint _worker_id;
+  // Index of the region the last cross-region reference pointed into. All
+  // references visited by this closure originate from the same card, so
+  // further references into that region need not be added again.
+  uint _last_to_region_idx;
 
 public:
   G1ConcurrentRefineOopClosure(G1CollectedHeap* g1h, uint worker_id) :
     _g1h(g1h),
-    _worker_id(worker_id) {
+    _worker_id(worker_id),
+    _last_to_region_idx(UINT_MAX) {
   }
 
   virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS; }
@@ -146,7 +146,14 @@ inline void G1ConcurrentRefineOopClosure::do_oop_work(T* p) {
     return;
   }
 
-  HeapRegionRemSet* to_rem_set = _g1h->heap_region_containing(obj)->rem_set();
+  uint to_region_idx = _g1h->addr_to_region(obj);
+  if (to_region_idx == _last_to_region_idx) {
+    // The card has already been recorded for this region.
+    return;
+  }
+  _last_to_region_idx = to_region_idx;
+
+  HeapRegionRemSet* to_rem_set = _g1h->region_at(to_region_idx)->rem_set();
 
   assert(to_rem_set != nullptr, "Need per-region 'into' remsets.");
   if (to_rem_set->is_tracked()) {
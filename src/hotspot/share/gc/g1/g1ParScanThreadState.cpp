@@ -85,6 +85,7 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _string_dedup_requests(),
     _max_num_optional_regions(collection_set->optional_region_length()),
     _numa(g1h->numa()),
+    _worker_node_index(UINT_MAX),
     _obj_alloc_stat(nullptr),
     ALLOCATION_FAILURE_INJECTOR_ONLY(_allocation_failure_inject_counter(0) COMMA)
     _preserved_marks(preserved_marks),
@@ -470,7 +471,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   G1HeapRegion* const from_region = _g1h->heap_region_containing(old);
-  uint node_index = from_region->node_index();
+  uint node_index = dest_node_index(from_region);
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
 
@@ -678,6 +679,11 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, siz
 
 void G1ParScanThreadState::initialize_numa_stats() {
   if (_numa->is_enabled()) {
+    if (G1NUMAEvacuateToWorkerNode) {
+      // Per-thread states are created lazily by the worker threads using them.
+      _worker_node_index = _numa->index_of_current_thread();
+    }
+
     LogTarget(Info, gc, heap, numa) lt;
 
     if (lt.is_enabled()) {
@@ -702,6 +708,13 @@ void G1ParScanThreadState::update_numa_stats(uint node_index) {
   }
 }
 
+uint G1ParScanThreadState::dest_node_index(const G1HeapRegion* from_region) const {
+  if (_worker_node_index != UINT_MAX) {
+    return _worker_node_index;
+  }
+  return from_region->node_index();
+}
+
 G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
                                                  uint num_workers,
                                                  G1CollectionSet* collection_set,
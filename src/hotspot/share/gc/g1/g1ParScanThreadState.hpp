@@ -98,6 +98,10 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   G1OopStarChunkedList* _oops_into_optional_regions;
 
   G1NUMA* _numa;
+  // Node index of the worker thread owning this state, used as destination
+  // node when copying to survivor regions with G1NUMAEvacuateToWorkerNode.
+  // UINT_MAX if objects are copied to the node of their source region.
+  uint _worker_node_index;
   // Records how many object allocations happened at each node during copy to survivor.
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
@@ -219,6 +223,8 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   void initialize_numa_stats();
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
+  // Returns the node index to allocate a copy of an object in from_region.
+  inline uint dest_node_index(const G1HeapRegion* from_region) const;
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
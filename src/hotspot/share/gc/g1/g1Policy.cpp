@@ -835,6 +835,11 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
     uint regions_allocated = _collection_set->eden_region_length();
     double alloc_rate_ms = (double) regions_allocated / app_time_ms;
     _analytics->report_alloc_rate_ms(alloc_rate_ms);
+
+    log_debug(gc, ergo)("Allocation rate: last %1.4f predicted %1.4f forecast %1.4f regions/ms",
+                        alloc_rate_ms,
+                        _analytics->predict_alloc_rate_ms(),
+                        _analytics->forecast_alloc_rate_ms());
   }
 
   record_pause(this_pause, start_time_sec, end_time_sec, allocation_failure);
@@ -1507,7 +1512,10 @@ double G1Policy::select_candidates_from_marking(G1CollectionCandidateList* marki
     // space from them (and we expect to get free space from marking candidates).
     // Also prepare to move them to retained regions to be evacuated optionally later
     // to not impact the mixed phase too much.
-    if (hr->has_pinned_objects()) {
+    // With G1EvacuatePinnedOldRegions, evacuate all objects that can not be pinned
+    // out of them instead, leaving only the pinnable ones behind in a retained
+    // region that is cheap to evacuate once it is unpinned.
+    if (hr->has_pinned_objects() && !G1EvacuatePinnedOldRegions) {
       num_pinned_regions++;
       (*iter)->update_num_unreclaimed();
       log_trace(gc, ergo, cset)("Marking candidate %u can not be reclaimed currently. Skipping.", hr->hrm_index());
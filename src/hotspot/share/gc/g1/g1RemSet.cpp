@@ -54,6 +54,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/stack.inline.hpp"
@@ -559,6 +561,18 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
       return ((uintptr_t)addr) % sizeof(Word) == 0;
     }
 
+    // Returns the index of the first card (in memory order) within a word
+    // whose bit is set in the given per-card mask, instead of testing the
+    // cards of the word one by one.
+    static size_t first_marked_card(Word mask) {
+      assert(mask != 0, "precondition");
+#ifdef VM_LITTLE_ENDIAN
+      return count_trailing_zeros(mask) / BitsPerByte;
+#else
+      return count_leading_zeros(mask) / BitsPerByte;
+#endif
+    }
+
     CardValue* find_first_dirty_card(CardValue* i_card) const {
       while (!is_word_aligned(i_card)) {
         if (is_card_dirty(i_card)) {
@@ -572,13 +586,9 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
         bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
 
         if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+          CardValue* result = i_card + first_marked_card(~word_value & ExpandedToScanMask);
+          assert(is_card_dirty(result), "must be");
+          return result;
         }
       }
 
@@ -598,13 +608,9 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
         bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
 
         if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+          CardValue* result = i_card + first_marked_card(word_value & ExpandedToScanMask);
+          assert(!is_card_dirty(result), "must be");
+          return result;
         }
       }
 
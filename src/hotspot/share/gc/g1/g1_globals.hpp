@@ -320,6 +320,39 @@
           "retained region restore purposes.")                              \
           range(1, 256)                                                     \
                                                                             \
+  product(bool, G1NUMAEvacuateToWorkerNode, false, EXPERIMENTAL,            \
+          "Copy surviving young objects into survivor regions on the NUMA " \
+          "node of the copying GC worker thread instead of the node of "    \
+          "the source region.")                                             \
+                                                                            \
+  product(uint, G1FullGCPartialCompactionPercent, 100, EXPERIMENTAL,        \
+          "Maximum number of regions with live objects, in percent of the " \
+          "committed regions, that a full collection compacts. The "        \
+          "remaining regions are left in place, shortening the compaction " \
+          "phase. Full collections doing maximal compaction always "        \
+          "compact all regions.")                                           \
+          range(1, 100)                                                     \
+                                                                            \
+  product(bool, G1UseAllocationRateForecast, false, EXPERIMENTAL,           \
+          "Size the young generation using a forecast of the allocation "   \
+          "rate that follows its recent trend, if that is higher than the " \
+          "average allocation rate.")                                       \
+                                                                            \
+  product(double, G1AllocationRateForecastAlpha, 0.5, EXPERIMENTAL,         \
+          "Smoothing factor of the allocation rate level used by "          \
+          "G1UseAllocationRateForecast.")                                   \
+          range(0.0, 1.0)                                                   \
+                                                                            \
+  product(double, G1AllocationRateForecastBeta, 0.3, EXPERIMENTAL,          \
+          "Smoothing factor of the allocation rate trend used by "          \
+          "G1UseAllocationRateForecast.")                                   \
+          range(0.0, 1.0)                                                   \
+                                                                            \
+  product(bool, G1EvacuatePinnedOldRegions, false, EXPERIMENTAL,            \
+          "Add marking candidates containing pinned objects to the "        \
+          "collection set, evacuating all objects that can not be pinned "  \
+          "and retaining the region with the rest.")                        \
+                                                                            \
   product(uint, G1NumCollectionsKeepPinned, 8, DIAGNOSTIC,                  \
           "After how many GCs a region has been found pinned G1 should "    \
           "give up reclaiming it.")                                         \
@@ -41,7 +41,13 @@
           "for a system GC")                                                \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(uintx, ParallelCompactMaxMovedPercent, 100, EXPERIMENTAL,         \
+          "Maximum live data, as a percentage of the old generation "       \
+          "capacity, moved by a full GC that is not a maximum compaction. " \
+          "The dense prefix is extended to stay within the limit")          \
+          range(0, 100)
 
 // end of GC_PARALLEL_FLAGS
 
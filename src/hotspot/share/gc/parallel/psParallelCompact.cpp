@@ -764,6 +764,22 @@ HeapWord* PSParallelCompact::compute_dense_prefix_for_old_space(MutableSpace* ol
     max_waste -= dead_size;
   }
 
+  if (ParallelCompactMaxMovedPercent < 100) {
+    // Bound the amount of live data moved by compaction, and so the pause
+    // time, by extending the dense prefix until the live data in the
+    // remaining regions fits into the budget. The dead space in the extended
+    // prefix is not reclaimed by this collection.
+    const size_t max_moved = old_space->capacity_in_words() * (ParallelCompactMaxMovedPercent / 100.0);
+    const RegionData* const top_region = sd.addr_to_region_ptr(sd.region_align_up(old_space->top()));
+    size_t live_after_prefix = 0;
+    for (const RegionData* r = cur_region; r < top_region; ++r) {
+      live_after_prefix += r->data_size();
+    }
+    for (/* empty */; cur_region < end_region && live_after_prefix > max_moved; ++cur_region) {
+      live_after_prefix -= cur_region->data_size();
+    }
+  }
+
   HeapWord* const prefix_end = sd.region_to_addr(cur_region);
   assert(sd.is_region_aligned(prefix_end), "postcondition");
   assert(prefix_end >= full_region_prefix_end, "in-range");
@@ -205,6 +205,11 @@ void PSPromotionManager::reset() {
   _old_lab.initialize(MemRegion(lab_base, (size_t)0));
   _old_gen_is_full = false;
 
+  _young_lab_size = YoungPLABSize;
+  _old_lab_size = OldPLABSize;
+  _young_lab_refills = 0;
+  _old_lab_refills = 0;
+
   _promotion_failed_info.reset();
 
   TASKQUEUE_STATS_ONLY(reset_stats());
@@ -245,9 +250,21 @@ void PSPromotionManager::drain_stacks_depth(bool totally_drain) {
   assert(tq->overflow_empty(), "Sanity");
 }
 
+size_t PSPromotionManager::next_lab_size(size_t cur_size, size_t base_size) {
+  if (!ResizePLAB) {
+    return cur_size;
+  }
+  return MIN2(cur_size * 2, base_size * max_lab_growth);
+}
+
 void PSPromotionManager::flush_labs() {
   assert(stacks_empty(), "Attempt to flush lab with live stack");
 
+  log_trace(gc, plab)("Young LAB refills: %u, final size: " SIZE_FORMAT "B, "
+                      "old LAB refills: %u, final size: " SIZE_FORMAT "B",
+                      _young_lab_refills, _young_lab_size * HeapWordSize,
+                      _old_lab_refills, _old_lab_size * HeapWordSize);
+
   // If either promotion lab fills up, we can flush the
   // lab but not refill it, so check first.
   assert(!_young_lab.is_flushed() || _young_gen_is_full, "Sanity");
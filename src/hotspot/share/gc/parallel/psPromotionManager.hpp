@@ -81,6 +81,17 @@ class PSPromotionManager {
   bool                                _young_gen_is_full;
   bool                                _old_gen_is_full;
 
+  // With ResizePLAB, each worker doubles its LAB sizes on every refill during
+  // a scavenge, up to max_lab_growth times YoungPLABSize/OldPLABSize, so that
+  // workers that copy a lot refill less often. Reset at the start of each GC.
+  static const size_t                 max_lab_growth = 8;
+  size_t                              _young_lab_size;
+  size_t                              _old_lab_size;
+  uint                                _young_lab_refills;
+  uint                                _old_lab_refills;
+
+  static size_t next_lab_size(size_t cur_size, size_t base_size);
+
   PSScannerTasksQueue                 _claimed_stack_depth;
 
   uint                                _target_stack_size;
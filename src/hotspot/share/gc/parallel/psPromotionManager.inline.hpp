@@ -177,7 +177,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
       new_obj = cast_to_oop(_young_lab.allocate(new_obj_size));
       if (new_obj == nullptr && !_young_gen_is_full) {
         // Do we allocate directly, or flush and refill?
-        if (new_obj_size > (YoungPLABSize / 2)) {
+        if (new_obj_size > (_young_lab_size / 2)) {
           // Allocate this object directly
           new_obj = cast_to_oop(young_space()->cas_allocate(new_obj_size));
           promotion_trace_event(new_obj, o, new_obj_size, age, false, nullptr);
@@ -185,9 +185,17 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
           // Flush and fill
           _young_lab.flush();
 
-          HeapWord* lab_base = young_space()->cas_allocate(YoungPLABSize);
+          size_t lab_size = _young_lab_size;
+          HeapWord* lab_base = young_space()->cas_allocate(lab_size);
+          if (lab_base == nullptr && lab_size > YoungPLABSize) {
+            // A grown LAB may no longer fit; retry with the base size.
+            lab_size = YoungPLABSize;
+            lab_base = young_space()->cas_allocate(lab_size);
+          }
           if (lab_base != nullptr) {
-            _young_lab.initialize(MemRegion(lab_base, YoungPLABSize));
+            _young_lab.initialize(MemRegion(lab_base, lab_size));
+            _young_lab_refills++;
+            _young_lab_size = next_lab_size(lab_size, YoungPLABSize);
             // Try the young lab allocation again.
             new_obj = cast_to_oop(_young_lab.allocate(new_obj_size));
             promotion_trace_event(new_obj, o, new_obj_size, age, false, &_young_lab);
@@ -213,7 +221,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
     if (new_obj == nullptr) {
       if (!_old_gen_is_full) {
         // Do we allocate directly, or flush and refill?
-        if (new_obj_size > (OldPLABSize / 2)) {
+        if (new_obj_size > (_old_lab_size / 2)) {
           // Allocate this object directly
           new_obj = cast_to_oop(old_gen()->allocate(new_obj_size));
           promotion_trace_event(new_obj, o, new_obj_size, age, true, nullptr);
@@ -221,9 +229,17 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
           // Flush and fill
           _old_lab.flush();
 
-          HeapWord* lab_base = old_gen()->allocate(OldPLABSize);
+          size_t lab_size = _old_lab_size;
+          HeapWord* lab_base = old_gen()->allocate(lab_size);
+          if (lab_base == nullptr && lab_size > OldPLABSize) {
+            // A grown LAB may no longer fit; retry with the base size.
+            lab_size = OldPLABSize;
+            lab_base = old_gen()->allocate(lab_size);
+          }
           if(lab_base != nullptr) {
-            _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
+            _old_lab.initialize(MemRegion(lab_base, lab_size));
+            _old_lab_refills++;
+            _old_lab_size = next_lab_size(lab_size, OldPLABSize);
             // Try the old lab allocation again.
             new_obj = cast_to_oop(_old_lab.allocate(new_obj_size));
             promotion_trace_event(new_obj, o, new_obj_size, age, true, &_old_lab);
@@ -168,9 +168,20 @@ template<typename Func>
 CardTable::CardValue* CardTableRS::find_first_clean_card(CardValue* const start_card,
                                                          CardValue* const end_card,
                                                          Func& object_start) {
+  using Word = uintptr_t;
+  STATIC_ASSERT(dirty_card == 0);
+
   for (CardValue* current_card = start_card; current_card < end_card; /* empty */) {
     if (is_dirty(current_card)) {
       current_card++;
+
+      // Skip runs of dirty cards a word at a time.
+      if (is_aligned(current_card, sizeof(Word))) {
+        while (current_card + sizeof(Word) <= end_card &&
+               *reinterpret_cast<Word*>(current_card) == (Word)0) {
+          current_card += sizeof(Word);
+        }
+      }
       continue;
     }
 
@@ -130,6 +130,11 @@
           "Number of parallel threads parallel gc will use")                \
           range(0, INT_MAX)                                                 \
                                                                             \
+  product(bool, UseNUMAAwareTaskStealing, false, EXPERIMENTAL,              \
+          "When stealing work from other GC worker task queues, first try " \
+          "queues of workers running on the same NUMA node. Requires "      \
+          "UseNUMA")                                                        \
+                                                                            \
   product(bool, UseDynamicNumberOfGCThreads, true,                          \
           "Dynamically choose the number of threads up to a maximum of "    \
           "ParallelGCThreads parallel collectors will use for garbage "     \
@@ -43,6 +43,9 @@
 #include "utilities/copy.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+// Payloads of at least this many words are cleared with memset.
+static const size_t LargeClearWords = 4 * K;
+
 class MemAllocator::Allocation: StackObj {
   friend class MemAllocator;
 
@@ -362,7 +365,16 @@ void MemAllocator::mem_clear(HeapWord* mem) const {
   const size_t hs = oopDesc::header_size();
   assert(_word_size >= hs, "unexpected object size");
   oopDesc::set_klass_gap(mem, 0);
-  Copy::fill_to_aligned_words(mem + hs, _word_size - hs);
+  const size_t payload_words = _word_size - hs;
+  if (payload_words >= LargeClearWords) {
+    // The object is not visible to anyone else yet, so the clearing does
+    // not need to be HeapWord-atomic. Hand large payloads to the platform
+    // memset, which picks its store strategy by size (e.g. rep stosb,
+    // cache line zeroing or non-temporal stores) instead of a word loop.
+    Copy::zero_to_bytes(mem + hs, payload_words * HeapWordSize);
+  } else {
+    Copy::fill_to_aligned_words(mem + hs, payload_words);
+  }
 }
 
 oop MemAllocator::finish(HeapWord* mem) const {
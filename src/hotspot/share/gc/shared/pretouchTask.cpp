@@ -30,6 +30,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/ticks.hpp"
 
 PretouchTask::PretouchTask(const char* task_name,
                            char* start_address,
@@ -68,6 +69,14 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
   // Page-align the chunk size, so if start_address is also page-aligned (as
   // is common) then there won't be any pages shared by multiple chunks.
   size_t chunk_size = align_down_bounded(PretouchTask::chunk_size(), page_size);
+#ifdef LINUX
+  // With THP the caller may pass the small page size, but the kernel backs
+  // the range with huge pages. Align the chunks to the huge page size so a
+  // huge page is never populated by more than one worker.
+  if (UseTransparentHugePages && os::large_page_size() > page_size) {
+    chunk_size = align_down_bounded(chunk_size, os::large_page_size());
+  }
+#endif
   PretouchTask task(task_name, start_address, end_address, page_size, chunk_size);
   size_t total_bytes = pointer_delta(end_address, start_address, sizeof(char));
 
@@ -75,6 +84,8 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
     return;
   }
 
+  Ticks start = Ticks::now();
+
   if (pretouch_workers != nullptr) {
     size_t num_chunks = ((total_bytes - 1) / chunk_size) + 1;
 
@@ -88,4 +99,7 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
                         task.name(), total_bytes);
     task.work(0);
   }
+
+  log_debug(gc, heap)("%s pre-touched " SIZE_FORMAT "B in %.3fms",
+                      task.name(), total_bytes, (Ticks::now() - start).seconds() * MILLIUNITS);
 }
@@ -73,7 +73,9 @@ TaskTerminator::TaskTerminator(uint n_threads, TaskQueueSetSuper* queue_set) :
   _queue_set(queue_set),
   _offered_termination(0),
   _blocker(Mutex::nosafepoint, "TaskTerminator_lock"),
-  _spin_master(nullptr) { }
+  _spin_master(nullptr) {
+  reset_numa_nodes();
+}
 
 TaskTerminator::~TaskTerminator() {
   if (_offered_termination != 0) {
@@ -89,6 +91,13 @@ void TaskTerminator::assert_queue_set_empty() const {
 }
 #endif
 
+void TaskTerminator::reset_numa_nodes() {
+  // A new parallel phase starts, the owners record their node again
+  if (UseNUMA && UseNUMAAwareTaskStealing && _queue_set != nullptr) {
+    _queue_set->reset_numa_nodes();
+  }
+}
+
 void TaskTerminator::reset_for_reuse() {
   if (_offered_termination != 0) {
     assert(_offered_termination == _n_threads,
@@ -96,6 +105,7 @@ void TaskTerminator::reset_for_reuse() {
     assert(_spin_master == nullptr, "Leftover spin master " PTR_FORMAT, p2i(_spin_master));
     _offered_termination = 0;
   }
+  reset_numa_nodes();
 }
 
 void TaskTerminator::reset_for_reuse(uint n_threads) {
@@ -91,6 +91,9 @@ class TaskTerminator : public CHeapObj<mtGC> {
 
   size_t tasks_in_queue_set() const;
 
+  // Clears the NUMA nodes recorded in the queue set for NUMA aware stealing.
+  void reset_numa_nodes();
+
   NONCOPYABLE(TaskTerminator);
 
 public:
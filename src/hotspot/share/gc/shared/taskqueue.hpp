@@ -404,10 +404,19 @@ class GenericTaskQueue: public TaskQueueSuper<N, F> {
 
   int _seed; // Current random seed used for selecting a random queue during stealing.
 
-  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, sizeof(uint) + sizeof(int));
+  // NUMA node the owner ran on in the current parallel phase, or -1 if unknown.
+  // Written by the owner on push and steal, read by thieves selecting a nearby
+  // victim, and reset at the start of each phase.
+  volatile int _numa_node;
+
+  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, sizeof(uint) + sizeof(int) + sizeof(int));
 public:
   int next_random_queue_id();
 
+  void set_numa_node(int node) { Atomic::store(&_numa_node, node); }
+  int numa_node() const        { return Atomic::load(&_numa_node); }
+  inline void record_numa_node();
+
   void set_last_stolen_queue_id(uint id)     { _last_stolen_queue_id = id; }
   uint last_stolen_queue_id() const          { return _last_stolen_queue_id; }
   bool is_last_stolen_queue_id_valid() const { return _last_stolen_queue_id != InvalidQueueId; }
@@ -465,6 +474,9 @@ class TaskQueueSetSuper {
 
   // Tasks in queue
   virtual uint tasks() const = 0;
+
+  // Forget the NUMA nodes recorded by the queue owners in the previous phase.
+  virtual void reset_numa_nodes() = 0;
 };
 
 template <MEMFLAGS F> class TaskQueueSetSuperImpl: public CHeapObj<F>, public TaskQueueSetSuper {
@@ -480,10 +492,15 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
   uint _n;
   T** _queues;
 
+  // Selects a random victim queue other than queue_num and exclude. If numa_node
+  // is not -1, a few attempts are made to find a queue owned by a worker on
+  // that NUMA node.
+  uint select_random_victim(T* local_queue, uint queue_num, uint exclude, int numa_node);
+
   // Attempts to steal an element from a foreign queue (!= queue_num), setting
   // the result in t. Validity of this value and the return value is the same
   // as for the last pop_global() operation.
-  PopResult steal_best_of_2(uint queue_num, E& t);
+  PopResult steal_best_of_2(uint queue_num, E& t, int numa_node);
 
 public:
   GenericTaskQueueSet(uint n);
@@ -503,6 +520,8 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
 
   virtual uint tasks() const;
 
+  virtual void reset_numa_nodes();
+
   uint size() const { return _n; }
 
 #if TASKQUEUE_STATS
@@ -548,6 +567,13 @@ uint GenericTaskQueueSet<T, F>::tasks() const {
   return n;
 }
 
+template<class T, MEMFLAGS F>
+void GenericTaskQueueSet<T, F>::reset_numa_nodes() {
+  for (uint j = 0; j < _n; j++) {
+    _queues[j]->set_numa_node(-1);
+  }
+}
+
 // When to terminate from the termination protocol.
 class TerminatorTerminator: public CHeapObj<mtInternal> {
 public:
@@ -33,7 +33,9 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
@@ -101,7 +103,8 @@ template<class E, MEMFLAGS F, unsigned int N>
 inline GenericTaskQueue<E, F, N>::GenericTaskQueue() :
   _elems(MallocArrayAllocator<E>::allocate(N, F)),
   _last_stolen_queue_id(InvalidQueueId),
-  _seed(17 /* random number */) {}
+  _seed(17 /* random number */),
+  _numa_node(-1) {}
 
 template<class E, MEMFLAGS F, unsigned int N>
 inline GenericTaskQueue<E, F, N>::~GenericTaskQueue() {
@@ -126,6 +129,9 @@ GenericTaskQueue<E, F, N>::push(E t) {
   // so can't underflow to -1 (== N-1) with push.
   assert(dirty_n_elems <= max_elems(), "n_elems out of range.");
   if (dirty_n_elems < max_elems()) {
+    if (UseNUMA && UseNUMAAwareTaskStealing) {
+      record_numa_node();
+    }
     _elems[localBot] = t;
     release_set_bottom(increment_index(localBot));
     TASKQUEUE_STATS_ONLY(stats.record_push());
@@ -316,8 +322,32 @@ int GenericTaskQueue<E, F, N>::next_random_queue_id() {
   return randomParkAndMiller(&_seed);
 }
 
+template<class E, MEMFLAGS F, unsigned int N>
+inline void GenericTaskQueue<E, F, N>::record_numa_node() {
+  // Only the first push of a phase looks up the node
+  if (Atomic::load(&_numa_node) == -1) {
+    set_numa_node(os::numa_get_group_id());
+  }
+}
+
 template<class T, MEMFLAGS F>
-typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
+uint GenericTaskQueueSet<T, F>::select_random_victim(T* local_queue, uint queue_num, uint exclude, int numa_node) {
+  const uint max_numa_attempts = 4;
+  uint k = queue_num;
+  for (uint attempts = 0; ; attempts++) {
+    k = queue_num;
+    while (k == queue_num || k == exclude) {
+      k = local_queue->next_random_queue_id() % _n;
+    }
+
+    if (numa_node == -1 || attempts == max_numa_attempts || queue(k)->numa_node() == numa_node) {
+      return k;
+    }
+  }
+}
+
+template<class T, MEMFLAGS F>
+typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t, int numa_node) {
   T* const local_queue = queue(queue_num);
   if (_n > 2) {
     uint k1 = queue_num;
@@ -326,15 +356,10 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
       k1 = local_queue->last_stolen_queue_id();
       assert(k1 != queue_num, "Should not be the same");
     } else {
-      while (k1 == queue_num) {
-        k1 = local_queue->next_random_queue_id() % _n;
-      }
+      k1 = select_random_victim(local_queue, queue_num, queue_num, numa_node);
     }
 
-    uint k2 = queue_num;
-    while (k2 == queue_num || k2 == k1) {
-      k2 = local_queue->next_random_queue_id() % _n;
-    }
+    uint k2 = select_random_victim(local_queue, queue_num, k1, numa_node);
     // Sample both and try the larger.
     uint sz1 = queue(k1)->size();
     uint sz2 = queue(k2)->size();
@@ -376,9 +401,17 @@ template<class T, MEMFLAGS F>
 bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
+  // With NUMA aware stealing, the first half of the attempts prefer victims
+  // owned by workers on the same NUMA node as the current thread.
+  int numa_node = -1;
+  if (UseNUMA && UseNUMAAwareTaskStealing) {
+    numa_node = os::numa_get_group_id();
+    queue(queue_num)->set_numa_node(numa_node);
+  }
+
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
-    PopResult sr = steal_best_of_2(queue_num, t);
+    PopResult sr = steal_best_of_2(queue_num, t, (i < num_retries / 2) ? numa_node : -1);
     if (sr == PopResult::Success) {
       return true;
     } else if (sr == PopResult::Contended) {
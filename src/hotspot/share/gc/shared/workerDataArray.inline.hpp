@@ -165,12 +165,16 @@ void WorkerDataArray<T>::print_summary_on(outputStream* out, bool print_sum) con
   if (start < _length) {
     T min = get(start);
     T max = min;
+    uint max_worker = start;
     T sum = 0;
     uint contributing_threads = 0;
     for (uint i = start; i < _length; ++i) {
       T value = get(i);
       if (value != uninitialized()) {
-        max = MAX2(max, value);
+        if (value > max) {
+          max = value;
+          max_worker = i;
+        }
         min = MIN2(min, value);
         sum += value;
         contributing_threads++;
@@ -180,7 +184,12 @@ void WorkerDataArray<T>::print_summary_on(outputStream* out, bool print_sum) con
     assert(contributing_threads != 0, "Must be since we found a used value for the start index");
     double avg = (double) sum / (double) contributing_threads;
     WDAPrinter::summary(out, min, avg, max, diff, sum, print_sum);
-    out->print_cr(", Workers: %d", contributing_threads);
+    out->print(", Workers: %d", contributing_threads);
+    if (contributing_threads > 1) {
+      // Name the straggler so it can be matched with the per-worker details.
+      out->print(", Max Worker: %u", max_worker);
+    }
+    out->cr();
   } else {
     // No data for this phase.
     out->print_cr(" skipped");
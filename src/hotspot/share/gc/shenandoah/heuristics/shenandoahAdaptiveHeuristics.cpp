@@ -26,6 +26,7 @@
 
 #include "gc/shenandoah/heuristics/shenandoahAdaptiveHeuristics.hpp"
 #include "gc/shenandoah/shenandoahCollectionSet.hpp"
+#include "gc/shenandoah/shenandoahCollectorPolicy.hpp"
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
@@ -178,9 +179,15 @@ void ShenandoahAdaptiveHeuristics::record_success_concurrent() {
 void ShenandoahAdaptiveHeuristics::record_success_degenerated() {
   ShenandoahHeuristics::record_success_degenerated();
   // Adjust both trigger's parameters in the case of a degenerated GC because
-  // either of them should have triggered earlier to avoid this case.
-  adjust_margin_of_error(DEGENERATE_PENALTY_SD);
-  adjust_spike_threshold(DEGENERATE_PENALTY_SD);
+  // either of them should have triggered earlier to avoid this case. Back-to-back
+  // degenerated cycles mean the previous adjustment was not enough, so the penalty
+  // grows with each one in a row.
+  size_t in_a_row = ShenandoahHeap::heap()->shenandoah_policy()->consecutive_degenerated_gc_count();
+  double penalty = DEGENERATE_PENALTY_SD * MAX2(in_a_row, (size_t)1);
+  adjust_margin_of_error(penalty);
+  adjust_spike_threshold(penalty);
+  log_info(gc, ergo)("Degenerated cycle (" SIZE_FORMAT " in a row): margin of error %.2f sd, spike threshold %.2f sd",
+                     in_a_row, _margin_of_error_sd, _spike_threshold_sd);
 }
 
 void ShenandoahAdaptiveHeuristics::record_success_full() {
@@ -29,11 +29,15 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
+#include "gc/shenandoah/shenandoahPadding.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.inline.hpp"
+#include "gc/shenandoah/shenandoahUtils.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/safepoint.hpp"
 
 static const char* partition_name(ShenandoahFreeSetPartitionId t) {
   switch (t) {
@@ -944,27 +948,93 @@ void ShenandoahFreeSet::clear_internal() {
   _partitions.make_all_regions_unavailable();
 }
 
-void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &cset_regions) {
+// Mutator partition bounds and counts for the regions with allocation capacity in a range of regions
+struct ShenandoahAllocCapacitySummary {
+  size_t _leftmost;
+  size_t _rightmost;
+  size_t _leftmost_empty;
+  size_t _rightmost_empty;
+  size_t _regions;
+  size_t _used;
+  size_t _cset_regions;
+
+  static ShenandoahAllocCapacitySummary empty(size_t max_regions) {
+    return { max_regions, 0, max_regions, 0, 0, 0, 0 };
+  }
 
-  cset_regions = 0;
-  clear_internal();
-  size_t region_size_bytes = _partitions.region_size_bytes();
-  size_t max_regions = _partitions.max_regions();
+  void merge(const ShenandoahAllocCapacitySummary& other) {
+    _leftmost = MIN2(_leftmost, other._leftmost);
+    _rightmost = MAX2(_rightmost, other._rightmost);
+    _leftmost_empty = MIN2(_leftmost_empty, other._leftmost_empty);
+    _rightmost_empty = MAX2(_rightmost_empty, other._rightmost_empty);
+    _regions += other._regions;
+    _used += other._used;
+    _cset_regions += other._cset_regions;
+  }
+};
+
+class ShenandoahFindAllocCapacityTask : public WorkerTask {
+private:
+  ShenandoahFreeSet* const                _free_set;
+  const size_t                            _num_regions;
+  const size_t                            _stride;
+  ShenandoahAllocCapacitySummary* const   _summaries;
+  const uint                              _nsummaries;
+
+  shenandoah_padding(0);
+  volatile size_t _index;
+  shenandoah_padding(1);
+
+public:
+  ShenandoahFindAllocCapacityTask(ShenandoahFreeSet* free_set, size_t num_regions, size_t max_regions, uint nworkers) :
+    WorkerTask("Shenandoah Find Regions With Alloc Capacity"),
+    _free_set(free_set),
+    _num_regions(num_regions),
+    // Chunks are aligned to bitmap words, so that workers never set bits in the same word
+    _stride(align_up(ShenandoahParallelRegionStride, (uintx)BitsPerWord)),
+    _summaries(NEW_C_HEAP_ARRAY(ShenandoahAllocCapacitySummary, nworkers, mtGC)),
+    _nsummaries(nworkers),
+    _index(0) {
+    for (uint i = 0; i < _nsummaries; i++) {
+      _summaries[i] = ShenandoahAllocCapacitySummary::empty(max_regions);
+    }
+  }
+
+  ~ShenandoahFindAllocCapacityTask() {
+    FREE_C_HEAP_ARRAY(ShenandoahAllocCapacitySummary, _summaries);
+  }
+
+  void work(uint worker_id) {
+    ShenandoahParallelWorkerSession worker_session(worker_id);
+    assert(worker_id < _nsummaries, "Invalid worker id");
+    ShenandoahAllocCapacitySummary& summary = _summaries[worker_id];
+
+    while (Atomic::load(&_index) < _num_regions) {
+      const size_t start = Atomic::fetch_then_add(&_index, _stride, memory_order_relaxed);
+      if (start >= _num_regions) {
+        break;
+      }
+      const size_t end = MIN2(start + _stride, _num_regions);
+      _free_set->find_regions_with_alloc_capacity_in(start, end, summary);
+    }
+  }
 
-  size_t mutator_leftmost = max_regions;
-  size_t mutator_rightmost = 0;
-  size_t mutator_leftmost_empty = max_regions;
-  size_t mutator_rightmost_empty = 0;
+  void merge_into(ShenandoahAllocCapacitySummary& summary) const {
+    for (uint i = 0; i < _nsummaries; i++) {
+      summary.merge(_summaries[i]);
+    }
+  }
+};
 
-  size_t mutator_regions = 0;
-  size_t mutator_used = 0;
+void ShenandoahFreeSet::find_regions_with_alloc_capacity_in(size_t start, size_t end, ShenandoahAllocCapacitySummary& summary) {
+  size_t region_size_bytes = _partitions.region_size_bytes();
 
-  for (size_t idx = 0; idx < _heap->num_regions(); idx++) {
+  for (size_t idx = start; idx < end; idx++) {
     ShenandoahHeapRegion* region = _heap->get_region(idx);
     if (region->is_trash()) {
       // Trashed regions represent regions that had been in the collection partition but have not yet been "cleaned up".
       // The cset regions are not "trashed" until we have finished update refs.
-      cset_regions++;
+      summary._cset_regions++;
     }
     if (region->is_alloc_allowed() || region->is_trash()) {
 
@@ -973,22 +1043,22 @@ void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &cset_regions) {
       if (ac > PLAB::min_size() * HeapWordSize) {
         _partitions.raw_assign_membership(idx, ShenandoahFreeSetPartitionId::Mutator);
 
-        if (idx < mutator_leftmost) {
-          mutator_leftmost = idx;
+        if (idx < summary._leftmost) {
+          summary._leftmost = idx;
         }
-        if (idx > mutator_rightmost) {
-          mutator_rightmost = idx;
+        if (idx > summary._rightmost) {
+          summary._rightmost = idx;
         }
         if (ac == region_size_bytes) {
-          if (idx < mutator_leftmost_empty) {
-            mutator_leftmost_empty = idx;
+          if (idx < summary._leftmost_empty) {
+            summary._leftmost_empty = idx;
           }
-          if (idx > mutator_rightmost_empty) {
-            mutator_rightmost_empty = idx;
+          if (idx > summary._rightmost_empty) {
+            summary._rightmost_empty = idx;
           }
         }
-        mutator_regions++;
-        mutator_used += (region_size_bytes - ac);
+        summary._regions++;
+        summary._used += (region_size_bytes - ac);
 
         log_debug(gc)(
           "  Adding Region " SIZE_FORMAT " (Free: " SIZE_FORMAT "%s, Used: " SIZE_FORMAT "%s) to mutator partition",
@@ -997,8 +1067,29 @@ void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &cset_regions) {
       }
     }
   }
-  _partitions.establish_mutator_intervals(mutator_leftmost, mutator_rightmost, mutator_leftmost_empty, mutator_rightmost_empty,
-                                          mutator_regions, mutator_used);
+}
+
+void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &cset_regions) {
+  clear_internal();
+  size_t max_regions = _partitions.max_regions();
+  size_t num_regions = _heap->num_regions();
+
+  ShenandoahAllocCapacitySummary summary = ShenandoahAllocCapacitySummary::empty(max_regions);
+
+  // On large heaps, scan the regions in parallel when the workers are available to us
+  WorkerThreads* const workers = _heap->workers();
+  if (SafepointSynchronize::is_at_safepoint() && workers != nullptr && num_regions > ShenandoahParallelRegionStride) {
+    ShenandoahFindAllocCapacityTask task(this, num_regions, max_regions, workers->active_workers());
+    workers->run_task(&task);
+    task.merge_into(summary);
+  } else {
+    find_regions_with_alloc_capacity_in(0, num_regions, summary);
+  }
+
+  cset_regions = summary._cset_regions;
+  _partitions.establish_mutator_intervals(summary._leftmost, summary._rightmost,
+                                          summary._leftmost_empty, summary._rightmost_empty,
+                                          summary._regions, summary._used);
 }
 
 void ShenandoahFreeSet::move_regions_from_collector_to_mutator(size_t max_xfer_regions) {
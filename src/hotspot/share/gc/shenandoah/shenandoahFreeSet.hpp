@@ -254,7 +254,11 @@ class ShenandoahRegionPartitions {
 //     sure there is enough memory reserved at the high end of memory to hold the objects that might need to be evacuated
 //     during the next GC pass.
 
+struct ShenandoahAllocCapacitySummary;
+
 class ShenandoahFreeSet : public CHeapObj<mtGC> {
+  friend class ShenandoahFindAllocCapacityTask;
+
 private:
   ShenandoahHeap* const _heap;
   ShenandoahRegionPartitions _partitions;
@@ -308,6 +312,11 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   // heap, with mutator memory consuming the lowest addresses of the heap.
   void find_regions_with_alloc_capacity(size_t &cset_regions);
 
+  // Places the regions in [start, end) that have allocation capacity into the mutator partition, and
+  // accumulates their counts and bounds into summary.  Ranges processed in parallel must not share
+  // words of the partition bitmaps.
+  void find_regions_with_alloc_capacity_in(size_t start, size_t end, ShenandoahAllocCapacitySummary& summary);
+
   // Having placed all regions that have allocation capacity into the mutator partition, move some of these regions from
   // the mutator partition into the collector partition in order to assure that the memory available for allocations within
   // the collector partition is at least to_reserve.
@@ -183,6 +183,8 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial, memory_order_relaxed);
   Atomic::store(&_tax_rate, tax_rate);
+  Atomic::store(&_epoch_alloc_words, (size_t)0);
+  Atomic::store(&_epoch_alloc_threads, (size_t)0);
   Atomic::inc(&_epoch);
 
   // Shake up stalled waiters after budget update.
@@ -223,9 +225,59 @@ intptr_t ShenandoahPacer::epoch() {
   return Atomic::load(&_epoch);
 }
 
+void ShenandoahPacer::record_alloc(JavaThread* thread, size_t words) {
+  // Account the allocation to the thread for the current epoch. The epoch
+  // total is only updated in batches, to keep atomics off the allocation path.
+  const intptr_t epoch = Atomic::load(&_epoch);
+  size_t thread_words = words;
+  size_t unpublished = words;
+  if (ShenandoahThreadLocalData::pacing_epoch(thread) == epoch) {
+    thread_words += ShenandoahThreadLocalData::pacing_alloc_words(thread);
+    unpublished += ShenandoahThreadLocalData::pacing_unpublished_words(thread);
+  } else {
+    Atomic::inc(&_epoch_alloc_threads, memory_order_relaxed);
+  }
+  if (unpublished >= PACING_PUBLISH_WORDS) {
+    Atomic::add(&_epoch_alloc_words, unpublished, memory_order_relaxed);
+    unpublished = 0;
+  }
+  ShenandoahThreadLocalData::set_pacing_alloc(thread, epoch, thread_words, unpublished);
+}
+
+bool ShenandoahPacer::is_below_fair_share(JavaThread* thread) {
+  const intptr_t epoch = Atomic::load(&_epoch);
+  if (ShenandoahThreadLocalData::pacing_epoch(thread) != epoch) {
+    return false;
+  }
+
+  // We are about to stall anyway, publish what this thread has not yet
+  size_t unpublished = ShenandoahThreadLocalData::pacing_unpublished_words(thread);
+  size_t thread_words = ShenandoahThreadLocalData::pacing_alloc_words(thread);
+  size_t total_words = Atomic::load(&_epoch_alloc_words);
+  if (unpublished > 0) {
+    total_words = Atomic::add(&_epoch_alloc_words, unpublished, memory_order_relaxed);
+    ShenandoahThreadLocalData::set_pacing_alloc(thread, epoch, thread_words, 0);
+  }
+
+  // With few allocating threads the average says little, and a single
+  // allocator is always at its average: pace everyone as usual then.
+  const size_t threads = Atomic::load(&_epoch_alloc_threads);
+  if (threads < PACING_FAIR_SHARE_MIN_THREADS) {
+    return false;
+  }
+
+  // Only exempt threads that are clearly below the average thread
+  return thread_words * PACING_FAIR_SHARE_MARGIN < total_words / threads;
+}
+
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
+  JavaThread* current = JavaThread::current();
+  if (ShenandoahPacingFairShare) {
+    record_alloc(current, words);
+  }
+
   // Fast path: try to allocate right away
   bool claimed = claim_for_alloc(words, false);
   if (claimed) {
@@ -246,12 +298,18 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // Thread which is not an active Java thread should also not block.
   // This can happen during VM init when main thread is still not an
   // active Java thread.
-  JavaThread* current = JavaThread::current();
   if (current->is_attaching_via_jni() ||
       !current->is_active_Java_thread()) {
     return;
   }
 
+  // Threads that allocated well below their fair share in this epoch
+  // are not stalled: the budget is depleted by the threads that allocate
+  // faster than the others, and those are the ones to wait for GC.
+  if (ShenandoahPacingFairShare && is_below_fair_share(current)) {
+    return;
+  }
+
   double start = os::elapsedTime();
 
   size_t max_ms = ShenandoahPacingMaxDelay;
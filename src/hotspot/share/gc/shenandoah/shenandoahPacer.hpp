@@ -31,6 +31,7 @@
 #include "memory/allocation.hpp"
 #include "runtime/task.hpp"
 
+class JavaThread;
 class ShenandoahHeap;
 class ShenandoahPacer;
 
@@ -51,6 +52,13 @@ class ShenandoahPeriodicPacerNotifyTask : public PeriodicTask {
 #define PACING_PROGRESS_UNINIT (-1)
 #define PACING_PROGRESS_ZERO   ( 0)
 
+// Threads publish their allocations to the epoch total in batches of this many words
+#define PACING_PUBLISH_WORDS   (64 * K)
+// Fair-share pacing needs this many allocating threads, and exempts only threads
+// that allocated less than 1/PACING_FAIR_SHARE_MARGIN of the average thread
+#define PACING_FAIR_SHARE_MIN_THREADS 4
+#define PACING_FAIR_SHARE_MARGIN      2
+
 /**
  * ShenandoahPacer provides allocation pacing mechanism.
  *
@@ -80,6 +88,14 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Allocations paced in this epoch (sampled, see PACING_PUBLISH_WORDS), and the
+  // number of threads doing them, used to find the threads allocating less than
+  // their fair share
+  shenandoah_padding(4);
+  volatile size_t _epoch_alloc_words;
+  volatile size_t _epoch_alloc_threads;
+  shenandoah_padding(5);
+
 public:
   explicit ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -90,7 +106,9 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {
+          _progress(PACING_PROGRESS_UNINIT),
+          _epoch_alloc_words(0),
+          _epoch_alloc_threads(0) {
     _notify_waiters_task.enroll();
   }
 
@@ -127,6 +145,9 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
 
   size_t update_and_get_progress_history();
 
+  void record_alloc(JavaThread* thread, size_t words);
+  bool is_below_fair_share(JavaThread* thread);
+
   void wait(size_t time_ms);
 };
 
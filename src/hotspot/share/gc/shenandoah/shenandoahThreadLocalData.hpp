@@ -45,6 +45,9 @@ class ShenandoahThreadLocalData {
   PLAB* _gclab;
   size_t _gclab_size;
   double _paced_time;
+  intptr_t _pacing_epoch;
+  size_t _pacing_alloc_words;
+  size_t _pacing_unpublished_words;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -53,7 +56,10 @@ class ShenandoahThreadLocalData {
     _satb_mark_queue(&ShenandoahBarrierSet::satb_mark_queue_set()),
     _gclab(nullptr),
     _gclab_size(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _pacing_epoch(0),
+    _pacing_alloc_words(0),
+    _pacing_unpublished_words(0) {
   }
 
   ~ShenandoahThreadLocalData() {
@@ -124,6 +130,24 @@ class ShenandoahThreadLocalData {
     data(thread)->_paced_time = 0;
   }
 
+  static intptr_t pacing_epoch(Thread* thread) {
+    return data(thread)->_pacing_epoch;
+  }
+
+  static size_t pacing_alloc_words(Thread* thread) {
+    return data(thread)->_pacing_alloc_words;
+  }
+
+  static size_t pacing_unpublished_words(Thread* thread) {
+    return data(thread)->_pacing_unpublished_words;
+  }
+
+  static void set_pacing_alloc(Thread* thread, intptr_t epoch, size_t words, size_t unpublished) {
+    data(thread)->_pacing_epoch = epoch;
+    data(thread)->_pacing_alloc_words = words;
+    data(thread)->_pacing_unpublished_words = unpublished;
+  }
+
   // Evacuation OOM handling
   static bool is_oom_during_evac(Thread* thread) {
     return data(thread)->_oom_during_evac;
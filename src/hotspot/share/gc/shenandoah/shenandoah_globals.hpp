@@ -246,6 +246,11 @@
           "GC effectively stall the threads indefinitely instead of going " \
           "to degenerated or Full GC.")                                     \
                                                                             \
+  product(bool, ShenandoahPacingFairShare, false, EXPERIMENTAL,             \
+          "When the pacing budget is depleted, do not stall threads that "  \
+          "allocated well below the average thread in the current pacing "  \
+          "phase. Only applies when several threads allocate.")             \
+                                                                            \
   product(uintx, ShenandoahPacingIdleSlack, 2, EXPERIMENTAL,                \
           "How much of heap counted as non-taxable allocations during idle "\
           "phases. Larger value makes the pacing milder when collector is " \
@@ -32,6 +32,7 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "runtime/os.hpp"
 
 ZDirector* ZDirector::_director;
 
@@ -391,6 +392,67 @@ static bool rule_minor_high_usage(const ZDirectorStats& stats) {
   return is_high_usage(stats, &print_function);
 }
 
+static double young_gc_cpu_overhead(const ZDirectorStats& stats) {
+  const ZStatCycleStats& cycle = stats._young_stats._cycle;
+  if (cycle._avg_cycle_interval <= 0.0) {
+    return 0.0;
+  }
+
+  // Average GC CPU time spent per second of wall clock time, relative
+  // to the CPU time available to the process.
+  const double gc_cpu_time = cycle._avg_serial_time + cycle._avg_parallelizable_time;
+  return percent_of(gc_cpu_time, cycle._avg_cycle_interval * os::active_processor_count());
+}
+
+static bool rule_minor_allocation_stall(const ZDirectorStats& stats) {
+  if (ZCollectionIntervalOnly || !ZAvoidAllocationStalls) {
+    // Rule disabled
+    return false;
+  }
+
+  if (!stats._young_stats._cycle._is_time_trustable) {
+    // Rule disabled
+    return false;
+  }
+
+  if (ZHeap::heap()->is_alloc_stalling_for_old() || is_young_small(stats)) {
+    // Same restrictions as for the allocation rate rule
+    return false;
+  }
+
+  const size_t stalls = MAX2(stats._young_stats._stat_heap._allocation_stalls,
+                             stats._old_stats._stat_heap._allocation_stalls);
+  if (stalls == 0) {
+    // The last cycles kept up with the allocation rate
+    return false;
+  }
+
+  // The last cycle ran into allocation stalls. Start the next minor
+  // collection as if the conservative allocation rate had to fit into
+  // the soft max capacity, trading extra GC CPU time for headroom, but
+  // only for as long as the GC CPU overhead stays within its limit.
+  const double gc_cpu_overhead = young_gc_cpu_overhead(stats);
+  if (gc_cpu_overhead >= ZGCCPUOverheadLimit) {
+    log_debug(gc, director)("Rule Minor: Allocation Stall, Stalls: " SIZE_FORMAT ", "
+                            "GCCPUOverhead: %.1f%%, Limit: %.1f%% (Exceeded)",
+                            stalls, gc_cpu_overhead, ZGCCPUOverheadLimit);
+    return false;
+  }
+
+  const ZDriverRequest request = rule_minor_allocation_rate_dynamic(stats,
+                                                                    0.0 /* serial_gc_time_passed */,
+                                                                    0.0 /* parallel_gc_time_passed */,
+                                                                    true /* conservative_alloc_rate */,
+                                                                    stats._heap._soft_max_heap_size /* capacity */);
+
+  log_debug(gc, director)("Rule Minor: Allocation Stall, Stalls: " SIZE_FORMAT ", "
+                          "GCCPUOverhead: %.1f%%, Limit: %.1f%%, Start: %s",
+                          stalls, gc_cpu_overhead, ZGCCPUOverheadLimit,
+                          request.cause() != GCCause::_no_gc ? "Yes" : "No");
+
+  return request.cause() != GCCause::_no_gc;
+}
+
 // Major GC rules
 
 static bool rule_major_timer(const ZDirectorStats& stats) {
@@ -613,6 +675,10 @@ static GCCause::Cause make_minor_gc_decision(const ZDirectorStats& stats) {
     return GCCause::_z_allocation_rate;
   }
 
+  if (rule_minor_allocation_stall(stats)) {
+    return GCCause::_z_allocation_rate;
+  }
+
   if (rule_minor_high_usage(stats)) {
     return GCCause::_z_high_usage;
   }
@@ -84,6 +84,9 @@ const size_t      ZMarkStripeShift              = ZGranuleSizeShift;
 // Max number of mark stripes
 const size_t      ZMarkStripesMax               = 16; // Must be a power of two
 
+// Max number of mark stack entries delayed for prefetching
+const size_t      ZMarkPrefetchDistanceMax      = 16;
+
 // Mark cache size
 const size_t      ZMarkCacheSize                = 1024; // Must be a power of two
 
@@ -37,19 +37,33 @@
 #include "gc/z/zHeapIterator.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zNMethod.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "memory/iterator.inline.hpp"
 #include "utilities/bitMap.inline.hpp"
 
+// Visit bitmap for the objects in one granule. The bitmap has one bit per
+// possible object start, given the object alignment of the page covering
+// the granule. Granules of medium and large pages therefore get much
+// smaller bitmaps than granules of small pages.
 class ZHeapIteratorBitMap : public CHeapObj<mtGC> {
 private:
-  CHeapBitMap _bitmap;
+  const size_t _object_alignment_shift;
+  CHeapBitMap  _bitmap;
+
+  size_t object_index(oop obj) const {
+    const zaddress addr = to_zaddress(obj);
+    const zoffset offset = ZAddress::offset(addr);
+    const uintptr_t mask = ZGranuleSize - 1;
+    return (untype(offset) & mask) >> _object_alignment_shift;
+  }
 
 public:
-  ZHeapIteratorBitMap(size_t size_in_bits)
-    : _bitmap(size_in_bits, mtGC) {}
+  ZHeapIteratorBitMap(size_t object_alignment_shift)
+    : _object_alignment_shift(object_alignment_shift),
+      _bitmap(MAX2(ZGranuleSize >> object_alignment_shift, (size_t)1), mtGC) {}
 
-  bool try_set_bit(size_t index) {
-    return _bitmap.par_set_bit(index);
+  bool try_set_bit(oop obj) {
+    return _bitmap.par_set_bit(object_index(obj));
   }
 };
 
@@ -300,17 +314,6 @@ ZHeapIterator::~ZHeapIterator() {
   ClassLoaderDataGraph::clear_claimed_marks(ClassLoaderData::_claim_other);
 }
 
-static size_t object_index_max() {
-  return ZGranuleSize >> ZObjectAlignmentSmallShift;
-}
-
-static size_t object_index(oop obj) {
-  const zaddress addr = to_zaddress(obj);
-  const zoffset offset = ZAddress::offset(addr);
-  const uintptr_t mask = ZGranuleSize - 1;
-  return (untype(offset) & mask) >> ZObjectAlignmentSmallShift;
-}
-
 ZHeapIteratorBitMap* ZHeapIterator::object_bitmap(oop obj) {
   const zoffset offset = ZAddress::offset(to_zaddress(obj));
   ZHeapIteratorBitMap* bitmap = _bitmaps.get_acquire(offset);
@@ -318,8 +321,9 @@ ZHeapIteratorBitMap* ZHeapIterator::object_bitmap(oop obj) {
     ZLocker<ZLock> locker(&_bitmaps_lock);
     bitmap = _bitmaps.get(offset);
     if (bitmap == nullptr) {
-      // Install new bitmap
-      bitmap = new ZHeapIteratorBitMap(object_index_max());
+      // Install new bitmap, sized for the object alignment of the page
+      const ZPage* const page = ZHeap::heap()->page(to_zaddress(obj));
+      bitmap = new ZHeapIteratorBitMap(page->object_alignment_shift());
       _bitmaps.release_put(offset, bitmap);
     }
   }
@@ -346,8 +350,7 @@ bool ZHeapIterator::mark_object(oop obj) {
   }
 
   ZHeapIteratorBitMap* const bitmap = object_bitmap(obj);
-  const size_t index = object_index(obj);
-  return bitmap->try_set_bit(index);
+  return bitmap->try_set_bit(obj);
 }
 
 typedef ClaimingCLDToOopClosure<ClassLoaderData::_claim_other> ZHeapIteratorCLDClosure;
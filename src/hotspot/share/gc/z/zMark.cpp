@@ -494,20 +494,73 @@ bool ZMark::rebalance_work(ZMarkContext* context) {
   return ZAbort::should_abort() || _generation->should_worker_resize();
 }
 
+static void prefetch_object(ZMarkStackEntry entry) {
+  if (!entry.partial_array()) {
+    // Prefetch the object header and klass pointer
+    Prefetch::read((void*)untype(ZOffset::address(to_zoffset(entry.object_address()))), 0);
+  }
+}
+
 bool ZMark::drain(ZMarkContext* context) {
   ZMarkThreadLocalStacks* const stacks = context->stacks();
   ZMarkStackEntry entry;
   size_t processed = 0;
 
+  // Popped entries are delayed in a small FIFO while their objects
+  // are prefetched. When following long chains of objects, this hides
+  // some of the memory latency of reading the object header and klass.
+  const size_t prefetch_distance = ZMarkPrefetchDistance;
+  ZMarkStackEntry prefetched[ZMarkPrefetchDistanceMax];
+  size_t prefetched_head = 0;
+  size_t prefetched_length = 0;
+
+  const auto follow_prefetched = [&]() {
+    while (prefetched_length > 0) {
+      const ZMarkStackEntry oldest = prefetched[prefetched_head];
+      prefetched_head = (prefetched_head + 1) % prefetch_distance;
+      prefetched_length--;
+      mark_and_follow(context, oldest);
+    }
+  };
+
   context->set_stripe(_stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id()));
   context->set_nstripes(_stripes.nstripes());
 
-  // Drain stripe stacks
-  while (stacks->pop(&_allocator, &_stripes, context->stripe(), entry)) {
-    mark_and_follow(context, entry);
+  for (;;) {
+    // Drain stripe stacks
+    while (stacks->pop(&_allocator, &_stripes, context->stripe(), entry)) {
+      if (prefetch_distance > 0) {
+        prefetch_object(entry);
+
+        if (prefetched_length < prefetch_distance) {
+          // Delay entry
+          prefetched[(prefetched_head + prefetched_length) % prefetch_distance] = entry;
+          prefetched_length++;
+          continue;
+        }
+
+        // Swap in the new entry and follow the oldest one
+        const ZMarkStackEntry oldest = prefetched[prefetched_head];
+        prefetched[prefetched_head] = entry;
+        prefetched_head = (prefetched_head + 1) % prefetch_distance;
+        entry = oldest;
+      }
 
-    if ((processed++ & 31) == 0 && rebalance_work(context)) {
-      return false;
+      mark_and_follow(context, entry);
+
+      if ((processed++ & 31) == 0 && rebalance_work(context)) {
+        // Delayed entries must not be lost, follow them before
+        // leaving. Any work they generate ends up on the stacks.
+        follow_prefetched();
+        return false;
+      }
+    }
+
+    // Following the delayed entries can push more work on the stacks
+    const bool had_prefetched = prefetched_length > 0;
+    follow_prefetched();
+    if (!had_prefetched) {
+      break;
     }
   }
 
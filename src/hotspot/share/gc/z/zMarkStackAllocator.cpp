@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/gcLogPrecious.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkStackAllocator.hpp"
@@ -86,8 +87,10 @@ size_t ZMarkStackSpace::expand_space() {
   log_debug(gc, marking)("Expanding mark stack space: " SIZE_FORMAT "M->" SIZE_FORMAT "M",
                          old_size / M, new_size / M);
 
-  // Expand
-  os::commit_memory_or_exit((char*)_end, expand_size, false /* executable */, "Mark stack space");
+  // Expand. Marking touches the mark stacks randomly from all workers,
+  // so ask for the memory to be backed by transparent huge pages (when
+  // enabled) to reduce TLB pressure.
+  os::commit_memory_or_exit((char*)_end, expand_size, ZGranuleSize /* alignment_hint */, false /* executable */, "Mark stack space");
 
   return expand_size;
 }
@@ -34,6 +34,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -50,6 +51,8 @@
 #include "utilities/debug.hpp"
 
 static const ZStatCriticalPhase ZCriticalPhaseRelocationStall("Relocation Stall");
+static const ZStatCounter ZCounterRelocateNUMALocal("Memory", "Relocate NUMA Local", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterRelocateNUMARemote("Memory", "Relocate NUMA Remote", ZStatUnitOpsPerSecond);
 static const ZStatSubPhase ZSubPhaseConcurrentRelocateRememberedSetFlipPromotedYoung("Concurrent Relocate Remset FP", ZGenerationId::young);
 
 ZRelocateQueue::ZRelocateQueue()
@@ -1054,9 +1057,88 @@ class ZRelocateStoreBufferInstallBasePointersTask : public ZTask {
   }
 };
 
+// Hands out forwardings of small pages whose memory is located on the NUMA
+// node of the calling worker. Small target pages are allocated from the
+// NUMA local page cache of the worker, so relocating these pages first
+// keeps both the reads and the writes of the copy local to the worker.
+class ZRelocateNUMALocalIterator : public StackObj {
+private:
+  const uint32_t       _numa_count;
+  ZArray<ZForwarding*> _forwardings;
+  size_t*              _start;
+  volatile size_t*     _next;
+
+  static bool is_enabled() {
+    return ZRelocateNUMALocal && ZNUMA::is_enabled() && ZNUMA::count() > 1;
+  }
+
+public:
+  ZRelocateNUMALocalIterator(ZRelocationSet* relocation_set)
+    : _numa_count(is_enabled() ? ZNUMA::count() : 0),
+      _forwardings(),
+      _start(nullptr),
+      _next(nullptr) {
+    if (_numa_count == 0) {
+      return;
+    }
+
+    _start = NEW_C_HEAP_ARRAY(size_t, _numa_count + 1, mtGC);
+    _next = NEW_C_HEAP_ARRAY(size_t, _numa_count, mtGC);
+
+    // Group the small pages by NUMA node. The NUMA id of a page is
+    // cached in the page, and is typically already known for pages
+    // that have been recycled through the page cache.
+    for (uint32_t numa_id = 0; numa_id < _numa_count; numa_id++) {
+      _start[numa_id] = (size_t)_forwardings.length();
+      _next[numa_id] = _start[numa_id];
+
+      ZRelocationSetIterator iter(relocation_set);
+      for (ZForwarding* forwarding; iter.next(&forwarding);) {
+        ZPage* const page = forwarding->page();
+        if (page->is_small() && page->numa_id() == numa_id) {
+          _forwardings.append(forwarding);
+        }
+      }
+    }
+
+    _start[_numa_count] = (size_t)_forwardings.length();
+  }
+
+  ~ZRelocateNUMALocalIterator() {
+    FREE_C_HEAP_ARRAY(size_t, _start);
+    FREE_C_HEAP_ARRAY(size_t, _next);
+  }
+
+  bool is_active() const {
+    return _numa_count > 0;
+  }
+
+  bool next(ZForwarding** forwarding) {
+    if (_numa_count == 0) {
+      return false;
+    }
+
+    const uint32_t numa_id = ZNUMA::id();
+    const size_t end = _start[numa_id + 1];
+    if (Atomic::load(&_next[numa_id]) >= end) {
+      // Fast path, no more local work
+      return false;
+    }
+
+    const size_t index = Atomic::fetch_then_add(&_next[numa_id], (size_t)1);
+    if (index >= end) {
+      return false;
+    }
+
+    *forwarding = _forwardings.at((int)index);
+    return true;
+  }
+};
+
 class ZRelocateTask : public ZRestartableTask {
 private:
   ZRelocationSetParallelIterator _iter;
+  ZRelocateNUMALocalIterator     _numa_local_iter;
   ZGeneration* const             _generation;
   ZRelocateQueue* const          _queue;
   ZRelocateSmallAllocator        _small_allocator;
@@ -1066,6 +1148,7 @@ class ZRelocateTask : public ZRestartableTask {
   ZRelocateTask(ZRelocationSet* relocation_set, ZRelocateQueue* queue)
     : ZRestartableTask("ZRelocateTask"),
       _iter(relocation_set),
+      _numa_local_iter(relocation_set),
       _generation(relocation_set->generation()),
       _queue(queue),
       _small_allocator(_generation),
@@ -1102,10 +1185,26 @@ class ZRelocateTask : public ZRestartableTask {
 
     const auto claim_and_do_forwarding = [&](ZForwarding* forwarding) {
       if (forwarding->claim()) {
+        ZPage* const page = forwarding->page();
+        if (_numa_local_iter.is_active() && page->is_small()) {
+          // The NUMA id is already cached in the page at this point
+          ZStatInc(page->numa_id() == ZNUMA::id() ? ZCounterRelocateNUMALocal : ZCounterRelocateNUMARemote);
+        }
         do_forwarding(forwarding);
       }
     };
 
+    const auto do_forwarding_one_from_numa_local_iter = [&]() {
+      ZForwarding* forwarding;
+
+      if (_numa_local_iter.next(&forwarding)) {
+        claim_and_do_forwarding(forwarding);
+        return true;
+      }
+
+      return false;
+    };
+
     const auto do_forwarding_one_from_iter = [&]() {
       ZForwarding* forwarding;
 
@@ -1127,7 +1226,8 @@ class ZRelocateTask : public ZRestartableTask {
         do_forwarding(forwarding);
       }
 
-      if (!do_forwarding_one_from_iter()) {
+      if (!do_forwarding_one_from_numa_local_iter() &&
+          !do_forwarding_one_from_iter()) {
         // No more work
         break;
       }
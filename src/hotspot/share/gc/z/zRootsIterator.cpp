@@ -32,6 +32,7 @@
 #include "prims/jvmtiTagMap.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/javaThread.hpp"
 #include "runtime/safepoint.hpp"
 #include "utilities/debug.hpp"
 
@@ -120,10 +121,58 @@ void ZCLDsIteratorAll::apply(CLDClosure* cl) {
   ClassLoaderDataGraph::cld_do(cl);
 }
 
+struct ZJavaThreadStackDepth {
+  JavaThread* _thread;
+  size_t      _depth;
+
+  static int compare(ZJavaThreadStackDepth* a, ZJavaThreadStackDepth* b) {
+    // Deepest first
+    return a->_depth > b->_depth ? -1 : (a->_depth < b->_depth ? 1 : 0);
+  }
+};
+
+static size_t stack_depth(JavaThread* jt) {
+  // Racy estimate of the used stack, only used to order the threads. A
+  // thread that moves on will at worst be claimed earlier or later.
+  const intptr_t* const sp = jt->last_Java_sp();
+  if (sp == nullptr) {
+    return 0;
+  }
+  const address base = jt->stack_base();
+  return base > (address)sp ? pointer_delta(base, sp, 1) : 0;
+}
+
+ZJavaThreadsIterator::ZJavaThreadsIterator(ZGenerationIdOptional generation)
+  : _threads(),
+    _claimed(0),
+    _generation(generation),
+    _deepest_first() {
+  if (ZProcessDeepStacksFirst) {
+    // Process the deepest stacks first, so that a single deep stack does
+    // not become the long pole at the end of concurrent root processing.
+    const uint length = _threads.length();
+    ZArray<ZJavaThreadStackDepth> depths((int)length);
+    for (uint i = 0; i < length; i++) {
+      JavaThread* const jt = _threads.thread_at(i);
+      depths.append({ jt, stack_depth(jt) });
+    }
+    depths.sort(ZJavaThreadStackDepth::compare);
+
+    _deepest_first.reserve((int)length);
+    for (int i = 0; i < depths.length(); i++) {
+      _deepest_first.append(depths.at(i)._thread);
+    }
+  }
+}
+
 uint ZJavaThreadsIterator::claim() {
   return Atomic::fetch_then_add(&_claimed, 1u);
 }
 
+JavaThread* ZJavaThreadsIterator::thread_at(uint i) const {
+  return _deepest_first.is_empty() ? _threads.thread_at(i) : _deepest_first.at((int)i);
+}
+
 void ZJavaThreadsIterator::apply(ThreadClosure* cl) {
   ZRootStatTimer timer(ZSubPhaseConcurrentRootsJavaThreads, _generation);
 
@@ -133,7 +182,7 @@ void ZJavaThreadsIterator::apply(ThreadClosure* cl) {
   ResourceMark rm;
 
   for (uint i = claim(); i < _threads.length(); i = claim()) {
-    cl->do_thread(_threads.thread_at(i));
+    cl->do_thread(thread_at(i));
   }
 }
 
@@ -25,6 +25,7 @@
 #define SHARE_GC_Z_ZROOTSITERATOR_HPP
 
 #include "gc/shared/oopStorageSetParState.hpp"
+#include "gc/z/zArray.hpp"
 #include "gc/z/zGenerationId.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.hpp"
@@ -115,14 +116,13 @@ class ZJavaThreadsIterator {
   ThreadsListHandle           _threads;
   volatile uint               _claimed;
   const ZGenerationIdOptional _generation;
+  ZArray<JavaThread*>         _deepest_first;
 
   uint claim();
+  JavaThread* thread_at(uint i) const;
 
 public:
-  ZJavaThreadsIterator(ZGenerationIdOptional generation)
-    : _threads(),
-      _claimed(0),
-      _generation(generation) {}
+  ZJavaThreadsIterator(ZGenerationIdOptional generation);
 
   void apply(ThreadClosure* cl);
 };
@@ -1901,13 +1901,22 @@ size_t ZStatHeap::stalls_at_relocate_end() const {
   return _at_relocate_end.allocation_stalls;
 }
 
+size_t ZStatHeap::allocation_stalls() const {
+  // Peak number of stalled allocations seen at the phase boundaries of the last cycle
+  return MAX4(_at_mark_start.allocation_stalls,
+              _at_mark_end.allocation_stalls,
+              _at_relocate_start.allocation_stalls,
+              _at_relocate_end.allocation_stalls);
+}
+
 ZStatHeapStats ZStatHeap::stats() {
   ZLocker<ZLock> locker(&_stat_lock);
 
   return {
     live_at_mark_end(),
     used_at_relocate_end(),
-    reclaimed_avg()
+    reclaimed_avg(),
+    allocation_stalls()
   };
 }
 
@@ -588,6 +588,7 @@ struct ZStatHeapStats {
   size_t _live_at_mark_end;
   size_t _used_at_relocate_end;
   size_t _reclaimed_avg;
+  size_t _allocation_stalls;
 };
 
 //
@@ -697,6 +698,7 @@ class ZStatHeap {
   size_t stalls_at_mark_end() const;
   size_t stalls_at_relocate_start() const;
   size_t stalls_at_relocate_end() const;
+  size_t allocation_stalls() const;
 
   size_t reclaimed_avg();
 
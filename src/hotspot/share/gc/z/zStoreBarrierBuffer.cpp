@@ -26,6 +26,7 @@
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zStat.hpp"
 #include "gc/z/zStoreBarrierBuffer.inline.hpp"
 #include "gc/z/zUncoloredRoot.inline.hpp"
 #include "memory/resourceArea.hpp"
@@ -33,6 +34,8 @@
 #include "utilities/ostream.hpp"
 #include "utilities/vmError.hpp"
 
+static const ZStatCounter ZCounterStoreBarrierBufferOverflow("Memory", "Store Barrier Buffer Overflow", ZStatUnitOpsPerSecond);
+
 ByteSize ZStoreBarrierEntry::p_offset() {
   return byte_offset_of(ZStoreBarrierEntry, _p);
 }
@@ -285,6 +288,11 @@ void ZStoreBarrierBuffer::flush() {
   clear();
 }
 
+void ZStoreBarrierBuffer::flush_on_overflow() {
+  ZStatInc(ZCounterStoreBarrierBufferOverflow);
+  flush();
+}
+
 bool ZStoreBarrierBuffer::is_in(volatile zpointer* p) {
   if (!ZBufferStoreBarriers) {
     return false;
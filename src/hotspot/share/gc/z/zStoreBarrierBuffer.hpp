@@ -72,6 +72,8 @@ class ZStoreBarrierBuffer : public CHeapObj<mtGC> {
 
   void install_base_pointers_inner();
 
+  void flush_on_overflow();
+
   void on_error(outputStream* st);
   class OnError;
 
@@ -44,6 +44,17 @@
   product(double, ZCollectionIntervalMajor, -1,                             \
           "Force GC at a fixed time interval (in seconds)")                 \
                                                                             \
+  product(bool, ZAvoidAllocationStalls, false, EXPERIMENTAL,                \
+          "Start minor collections earlier after a cycle that saw "         \
+          "allocation stalls, as long as the GC CPU overhead stays below "  \
+          "ZGCCPUOverheadLimit")                                            \
+                                                                            \
+  product(double, ZGCCPUOverheadLimit, 10.0, EXPERIMENTAL,                  \
+          "Maximum percentage of the available CPU time that young "        \
+          "collections may use before ZAvoidAllocationStalls stops "        \
+          "starting collections earlier")                                   \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, ZCollectionIntervalOnly, false,                             \
           "Only use timers for GC heuristics")                              \
                                                                             \
@@ -71,6 +82,19 @@
           "Young generation tenuring threshold, -1 for dynamic computation")\
           range(-1, static_cast<int>(ZPageAgeMax))                          \
                                                                             \
+  product(bool, ZRelocateNUMALocal, false, EXPERIMENTAL,                    \
+          "Relocate small pages located on the NUMA node of the "           \
+          "relocating worker before relocating other pages")                \
+                                                                            \
+  product(uint, ZMarkPrefetchDistance, 0, EXPERIMENTAL,                     \
+          "Number of popped mark stack entries whose objects are "          \
+          "prefetched before being followed, 0 to disable")                 \
+          range(0, static_cast<uint>(ZMarkPrefetchDistanceMax))             \
+                                                                            \
+  product(bool, ZProcessDeepStacksFirst, false, EXPERIMENTAL,               \
+          "Let concurrent root processing claim the threads with the "      \
+          "deepest stacks first")                                           \
+                                                                            \
   develop(size_t, ZForceDiscontiguousHeapReservations, 0,                   \
           "The gc will attempt to split the heap reservation into this "    \
           "many reservations, subject to available virtual address space "  \
@@ -32,6 +32,7 @@
 #include "oops/generateOopMap.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/signature.hpp"
@@ -443,27 +444,32 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
+volatile size_t OopMapCache::_hits = 0;
+volatile size_t OopMapCache::_misses = 0;
 
-OopMapCache::OopMapCache() {
-  for(int i = 0; i < size; i++) _array[i] = nullptr;
+OopMapCache::OopMapCache() :
+  _size(OopMapCacheSize),
+  _array(NEW_C_HEAP_ARRAY(OopMapCacheEntry* volatile, OopMapCacheSize, mtClass)) {
+  for(int i = 0; i < _size; i++) _array[i] = nullptr;
 }
 
 
 OopMapCache::~OopMapCache() {
   // Deallocate oop maps that are allocated out-of-line
   flush();
+  FREE_C_HEAP_ARRAY(OopMapCacheEntry* volatile, _array);
 }
 
 OopMapCacheEntry* OopMapCache::entry_at(int i) const {
-  return Atomic::load_acquire(&(_array[i % size]));
+  return Atomic::load_acquire(&(_array[i % _size]));
 }
 
 bool OopMapCache::put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old) {
-  return Atomic::cmpxchg(&_array[i % size], old, entry) == old;
+  return Atomic::cmpxchg(&_array[i % _size], old, entry) == old;
 }
 
 void OopMapCache::flush() {
-  for (int i = 0; i < size; i++) {
+  for (int i = 0; i < _size; i++) {
     OopMapCacheEntry* entry = _array[i];
     if (entry != nullptr) {
       _array[i] = nullptr;  // no barrier, only called in OopMapCache destructor
@@ -474,7 +480,7 @@ void OopMapCache::flush() {
 
 void OopMapCache::flush_obsolete_entries() {
   assert(SafepointSynchronize::is_at_safepoint(), "called by RedefineClasses in a safepoint");
-  for (int i = 0; i < size; i++) {
+  for (int i = 0; i < _size; i++) {
     OopMapCacheEntry* entry = _array[i];
     if (entry != nullptr && !entry->is_empty() && entry->method()->is_old()) {
       // Cache entry is occupied by an old redefined method and we don't want
@@ -496,8 +502,9 @@ void OopMapCache::lookup(const methodHandle& method,
                          int bci,
                          InterpreterOopMap* entry_for) {
   int probe = hash_value_for(method, bci);
+  const bool log = log_is_enabled(Debug, interpreter, oopmap);
 
-  if (log_is_enabled(Debug, interpreter, oopmap)) {
+  if (log) {
     static int count = 0;
     ResourceMark rm;
     log_debug(interpreter, oopmap)
@@ -514,7 +521,11 @@ void OopMapCache::lookup(const methodHandle& method,
       if (entry != nullptr && !entry->is_empty() && entry->match(method, bci)) {
         entry_for->resource_copy(entry);
         assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
-        log_debug(interpreter, oopmap)("- found at hash %d", probe + i);
+        if (log) {
+          size_t hits = Atomic::add(&_hits, (size_t)1, memory_order_relaxed);
+          log_debug(interpreter, oopmap)("- found at hash %d (hits: " SIZE_FORMAT ", misses: " SIZE_FORMAT ")",
+                                         probe + i, hits, Atomic::load(&_misses));
+        }
         return;
       }
     }
@@ -522,6 +533,11 @@ void OopMapCache::lookup(const methodHandle& method,
 
   // Entry is not in hashtable.
   // Compute entry
+  if (log) {
+    size_t misses = Atomic::add(&_misses, (size_t)1, memory_order_relaxed);
+    log_debug(interpreter, oopmap)("- not found (hits: " SIZE_FORMAT ", misses: " SIZE_FORMAT ")",
+                                   Atomic::load(&_hits), misses);
+  }
 
   OopMapCacheEntry* tmp = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
   tmp->initialize();
@@ -152,10 +152,14 @@ class InterpreterOopMap: ResourceObj {
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
  private:
-  static constexpr int size = 32;        // Use fixed size for now
   static constexpr int probe_depth = 3;  // probe depth in case of collisions
 
-  OopMapCacheEntry* volatile _array[size];
+  // Lookup statistics, only maintained when interpreter+oopmap logging is enabled
+  static volatile size_t _hits;
+  static volatile size_t _misses;
+
+  const int _size;                       // number of entries, see OopMapCacheSize
+  OopMapCacheEntry* volatile* _array;
 
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
   OopMapCacheEntry* entry_at(int i) const;
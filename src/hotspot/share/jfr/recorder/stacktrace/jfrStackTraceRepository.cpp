@@ -28,13 +28,19 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
  * One instance is dedicated to stacktraces taken as part of the leak profiler subsystem.
  * It is kept separate because at the point of insertion, it is unclear if a trace will be serialized,
  * which is a decision postponed and taken during rotation.
+ *
+ * Lookups of already known traces do not take the JfrStacktrace_lock. Entries are immutable
+ * once published at the head of a bucket, and they are only deleted after a GlobalCounter
+ * write_synchronize, so a lock-free reader never sees a freed entry.
  */
 
 static JfrStackTraceRepository* _instance = nullptr;
@@ -97,6 +103,26 @@ bool JfrStackTraceRepository::is_modified() const {
   return _last_entries != _entries;
 }
 
+// Unlinks all buckets, waits for concurrent lock-free readers to leave, then frees the entries.
+void JfrStackTraceRepository::delete_entries() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace** const detached = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    detached[i] = _table[i];
+    Atomic::store(&_table[i], (JfrStackTrace*)nullptr);
+  }
+  GlobalCounter::write_synchronize();
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    JfrStackTrace* stacktrace = detached[i];
+    while (stacktrace != nullptr) {
+      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
+      delete stacktrace;
+      stacktrace = next;
+    }
+  }
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, detached);
+}
+
 size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   if (_entries == 0) {
@@ -104,21 +130,17 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   }
   int count = 0;
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    const JfrStackTrace* stacktrace = _table[i];
     while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       if (stacktrace->should_write()) {
         stacktrace->write(sw);
         ++count;
       }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
+      stacktrace = stacktrace->next();
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
+    delete_entries();
     _entries = 0;
   }
   _last_entries = _entries;
@@ -130,15 +152,7 @@ size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
   if (repo._entries == 0) {
     return 0;
   }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
-    while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
-    }
-  }
-  memset(repo._table, 0, sizeof(repo._table));
+  repo.delete_entries();
   const size_t processed = repo._entries;
   repo._entries = 0;
   repo._last_entries = 0;
@@ -198,25 +212,42 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* current_threa
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(stacktrace._nr_of_frames > 0, "invariant");
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
+static traceid find_in_bucket(const JfrStackTrace* table_entry, const JfrStackTrace& stacktrace) {
   while (table_entry != nullptr) {
     if (table_entry->equals(stacktrace)) {
       return table_entry->id();
     }
     table_entry = table_entry->next();
   }
+  return 0;
+}
+
+traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  assert(stacktrace._nr_of_frames > 0, "invariant");
+  const size_t index = stacktrace._hash % TABLE_SIZE;
+
+  // Most recorded traces are already known; look them up without taking the lock.
+  {
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const traceid id = find_in_bucket(Atomic::load_acquire(&_table[index]), stacktrace);
+    if (id != 0) {
+      return id;
+    }
+  }
+
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  // Recheck under the lock, another thread may have added the trace meanwhile.
+  const traceid found = find_in_bucket(_table[index], stacktrace);
+  if (found != 0) {
+    return found;
+  }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
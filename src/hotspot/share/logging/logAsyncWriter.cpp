@@ -78,11 +78,16 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
     bool p_created;
     uint32_t* counter = _stats.put_if_absent(output, 0, &p_created);
     *counter = *counter + 1;
+    Atomic::store(&_dropped_messages, _dropped_messages + 1);
     return;
   }
 
-  _data_available = true;
-  _lock.notify();
+  // The writer only waits once it has consumed all data, so only the first
+  // message after a swap needs to wake it up.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
@@ -103,7 +108,8 @@ void AsyncLogWriter::enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iter
 AsyncLogWriter::AsyncLogWriter()
   : _flush_sem(0), _lock(), _data_available(false),
     _initialized(false),
-    _stats() {
+    _stats(),
+    _dropped_messages(0) {
 
   size_t size = AsyncLogBufferSize / 2;
   _buffer = new Buffer(size);
@@ -205,6 +211,10 @@ AsyncLogWriter* AsyncLogWriter::instance() {
   return _instance;
 }
 
+uint64_t AsyncLogWriter::dropped_messages() const {
+  return Atomic::load(&_dropped_messages);
+}
+
 // Inserts a flush token into the async output buffer and waits until the AsyncLog thread
 // signals that it has seen it and completed all dequeued message processing.
 // This method is not MT-safe in itself, but is guarded by another lock in the usual
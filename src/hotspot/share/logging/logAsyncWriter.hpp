@@ -163,6 +163,8 @@ class AsyncLogWriter : public NonJavaThread {
   bool _data_available;
   volatile bool _initialized;
   AsyncLogMap<AnyObj::C_HEAP> _stats;
+  // Messages dropped over the lifetime of the writer, across all outputs.
+  volatile uint64_t _dropped_messages;
 
   // ping-pong buffers
   Buffer* _buffer;
@@ -202,6 +204,7 @@ class AsyncLogWriter : public NonJavaThread {
   static AsyncLogWriter* instance();
   static void initialize();
   static void flush();
+  uint64_t dropped_messages() const;
 
   const char* name() const override { return "AsyncLog Thread"; }
 };
@@ -573,6 +573,10 @@ void LogConfiguration::describe_current_configuration(outputStream* out) {
     }
     out->cr();
   }
+  AsyncLogWriter* const async = AsyncLogWriter::instance();
+  if (async != nullptr) {
+    out->print_cr("Async logging: " UINT64_FORMAT " messages dropped", async->dropped_messages());
+  }
 }
 
 void LogConfiguration::describe(outputStream* out) {
@@ -625,6 +629,9 @@ void LogConfiguration::print_command_line_help(outputStream* out) {
                                        " with a sequence of two backslashes so that the conversion can be reversed."
                                        " This option is safe to use with UTF-8 character encodings,"
                                        " but other encodings may not work.");
+  out->print_cr(" format=..         - Either 'text' (default) or 'json'. With 'json', each log event is written"
+                                       " as one JSON object per line, with the selected decorators as string fields"
+                                       " named after the decorator and the message text in the 'msg' field.");
   out->cr();
 
   out->print_cr("Additional file output options:");
@@ -32,6 +32,7 @@
 #include "utilities/defaultStream.hpp"
 
 const char* const LogFileStreamOutput::FoldMultilinesOptionKey = "foldmultilines";
+const char* const LogFileStreamOutput::FormatOptionKey = "format";
 
 bool LogFileStreamOutput::set_option(const char* key, const char* value, outputStream* errstream) {
   bool success = false;
@@ -45,6 +46,16 @@ bool LogFileStreamOutput::set_option(const char* key, const char* value, outputS
     } else {
       errstream->print_cr("Invalid option: %s must be 'true' or 'false'.", key);
     }
+  } else if (strcmp(FormatOptionKey, key) == 0) {
+    if (strcmp(value, "text") == 0) {
+      _json = false;
+      success = true;
+    } else if (strcmp(value, "json") == 0) {
+      _json = true;
+      success = true;
+    } else {
+      errstream->print_cr("Invalid option: %s must be 'text' or 'json'.", key);
+    }
   }
   return success;
 }
@@ -115,7 +126,64 @@ bool LogFileStreamOutput::flush() {
   total += result;                                            \
 }
 
+// Writes str as a quoted JSON string, escaping quotes, backslashes and control characters.
+int LogFileStreamOutput::write_json_string(const char* str) {
+  int written = 0;
+  WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "\""), written);
+  const char* cur = str;
+  while (*cur != '\0') {
+    const char* next = cur;
+    while (*next != '\0' && *next != '"' && *next != '\\' && (unsigned char)*next >= 0x20) {
+      next++;
+    }
+    if (next > cur) {
+      WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "%.*s", (int)(next - cur), cur), written);
+    }
+    if (*next == '\0') {
+      break;
+    }
+    switch (*next) {
+      case '"':  WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "\\\""), written); break;
+      case '\\': WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "\\\\"), written); break;
+      case '\n': WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "\\n"), written); break;
+      case '\t': WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "\\t"), written); break;
+      default:
+        WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "\\u%04x", (unsigned char)*next), written);
+        break;
+    }
+    cur = next + 1;
+  }
+  WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "\""), written);
+  return written;
+}
+
+// Writes one log event as a single JSON object line. Each selected decorator
+// becomes a field named after the decorator, the message text goes to "msg".
+int LogFileStreamOutput::write_json(const LogDecorations& decorations, const char* msg) {
+  int written = 0;
+  char buf[LogDecorations::max_decoration_size + 1];
+
+  WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "{"), written);
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    LogDecorators::Decorator decorator = static_cast<LogDecorators::Decorator>(i);
+    if (!_decorators.is_decorator(decorator)) {
+      continue;
+    }
+    WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "\"%s\":", LogDecorators::name(decorator)), written);
+    WRITE_LOG_WITH_RESULT_CHECK(write_json_string(decorations.decoration(decorator, buf, sizeof(buf))), written);
+    WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, ","), written);
+  }
+  WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "\"msg\":"), written);
+  WRITE_LOG_WITH_RESULT_CHECK(write_json_string(msg), written);
+  WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "}\n"), written);
+  return written;
+}
+
 int LogFileStreamOutput::write_internal(const LogDecorations& decorations, const char* msg) {
+  if (_json) {
+    return write_json(decorations, msg);
+  }
+
   int written = 0;
   const bool use_decorations = !_decorators.is_empty();
 
@@ -185,4 +253,7 @@ void LogFileStreamOutput::describe(outputStream *out) {
   out->print(" ");
 
   out->print("foldmultilines=%s", _fold_multilines ? "true" : "false");
+  if (_json) {
+    out->print(",format=json");
+  }
 }
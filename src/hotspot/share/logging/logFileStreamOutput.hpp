@@ -35,20 +35,24 @@ class LogDecorations;
 class LogFileStreamOutput : public LogOutput {
  private:
   static const char* const FoldMultilinesOptionKey;
+  static const char* const FormatOptionKey;
   bool                _fold_multilines;
+  bool                _json;
   bool                _write_error_is_shown;
 
  protected:
   FILE*               _stream;
   size_t              _decorator_padding[LogDecorators::Count];
 
-  LogFileStreamOutput(FILE *stream) : _fold_multilines(false), _write_error_is_shown(false), _stream(stream) {
+  LogFileStreamOutput(FILE *stream) : _fold_multilines(false), _json(false), _write_error_is_shown(false), _stream(stream) {
     for (size_t i = 0; i < LogDecorators::Count; i++) {
       _decorator_padding[i] = 0;
     }
   }
 
   int write_decorations(const LogDecorations& decorations);
+  int write_json_string(const char* str);
+  int write_json(const LogDecorations& decorations, const char* msg);
   int write_internal(const LogDecorations& decorations, const char* msg);
   bool flush();
 
@@ -32,6 +32,7 @@
 #include "nmt/memTracker.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
 #include "runtime/trimNativeHeap.hpp"
 #include "utilities/align.hpp"
@@ -45,7 +46,10 @@ STATIC_ASSERT(is_aligned((int)Chunk::medium_size, ARENA_AMALLOC_ALIGNMENT));
 STATIC_ASSERT(is_aligned((int)Chunk::size, ARENA_AMALLOC_ALIGNMENT));
 
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
-// NB: not using Mutex because pools are used before Threads are initialized
+// NB: not using Mutex because pools are used before Threads are initialized.
+// Each pool has its own spin lock, held only to link or unlink a chunk, so
+// that compiler threads churning through chunks do not contend on the global
+// ThreadCritical lock.
 class ChunkPool {
   // Our four static pools
   static constexpr int _num_pools = 4;
@@ -53,36 +57,41 @@ class ChunkPool {
 
   Chunk*       _first;
   const size_t _size;         // (inner payload) size of the chunks this pool serves
+  volatile int _lock;
 
   // Returns null if pool is empty.
   Chunk* take_from_pool() {
-    ThreadCritical tc;
+    Thread::SpinAcquire(&_lock, "ChunkPool");
     Chunk* c = _first;
     if (_first != nullptr) {
       _first = _first->next();
     }
+    Thread::SpinRelease(&_lock);
     return c;
   }
   void return_to_pool(Chunk* chunk) {
     assert(chunk->length() == _size, "wrong pool for this chunk");
-    ThreadCritical tc;
+    Thread::SpinAcquire(&_lock, "ChunkPool");
     chunk->set_next(_first);
     _first = chunk;
+    Thread::SpinRelease(&_lock);
   }
 
   // Clear this pool of all contained chunks
   void prune() {
+    Thread::SpinAcquire(&_lock, "ChunkPool");
+    Chunk* cur = _first;
+    _first = nullptr;
+    Thread::SpinRelease(&_lock);
     // Free all chunks while in ThreadCritical lock
     // so NMT adjustment is stable.
     ThreadCritical tc;
-    Chunk* cur = _first;
     Chunk* next = nullptr;
     while (cur != nullptr) {
       next = cur->next();
       os::free(cur);
       cur = next;
     }
-    _first = nullptr;
   }
 
   // Given a (inner payload) size, return the pool responsible for it, or null if the size is non-standard
@@ -96,7 +105,7 @@ class ChunkPool {
   }
 
 public:
-  ChunkPool(size_t size) : _first(nullptr), _size(size) {}
+  ChunkPool(size_t size) : _first(nullptr), _size(size), _lock(0) {}
 
   static void clean() {
     NativeHeapTrimmer::SuspendMark sm("chunk pool cleaner");
@@ -144,7 +153,7 @@ Chunk* ChunkPool::allocate_chunk(size_t length, AllocFailType alloc_failmode) {
   if (chunk == nullptr) {
     // Either the pool was empty, or this is a non-standard length. Allocate a new Chunk from C-heap.
     size_t bytes = ARENA_ALIGN(sizeof(Chunk)) + length;
-    void* p = os::malloc(bytes, mtChunk, CALLER_PC);
+    void* p = os::malloc(bytes, mtChunk, MALLOC_CALLER_PC);
     if (p == nullptr && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
       vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
     }
@@ -550,6 +550,16 @@ size_t CodeHeap::heap_unallocated_capacity() const {
   return segments_to_size(_number_of_reserved_segments - _next_segment);
 }
 
+// Returns size of the largest block that could be allocated without
+// expanding into already fragmented space.
+size_t CodeHeap::largest_free_block() const {
+  size_t largest = _number_of_reserved_segments - _next_segment;
+  for (FreeBlock* b = _freelist; b != nullptr; b = b->link()) {
+    largest = MAX2(largest, b->length());
+  }
+  return segments_to_size(largest);
+}
+
 // Free list management
 
 FreeBlock* CodeHeap::following_block(FreeBlock *b) {
@@ -25,6 +25,7 @@
 
 #include "precompiled.hpp"
 #include "memory/metaspace.hpp"
+#include "memory/metaspace/chunkManager.hpp"
 #include "memory/metaspace/metaspaceDCmd.hpp"
 #include "memory/metaspace/metaspaceReporter.hpp"
 #include "memory/metaspaceUtils.hpp"
@@ -46,7 +47,8 @@ MetaspaceDCmd::MetaspaceDCmd(outputStream* output, bool heap) :
   _scale("scale", "Memory usage in which to scale. Valid values are: 1, KB, MB or GB (fixed scale) "
          "or \"dynamic\" for a dynamically chosen scale.",
          "STRING", false, "dynamic"),
-  _show_classes("show-classes", "If show-loaders is set, shows loaded classes for each loader.", "BOOLEAN", false, "false")
+  _show_classes("show-classes", "If show-loaders is set, shows loaded classes for each loader.", "BOOLEAN", false, "false"),
+  _purge("purge", "Returns the memory of free chunks to the operating system before printing.", "BOOLEAN", false, "false")
 {
   _dcmdparser.add_dcmd_option(&_basic);
   _dcmdparser.add_dcmd_option(&_show_loaders);
@@ -56,6 +58,7 @@ MetaspaceDCmd::MetaspaceDCmd(outputStream* output, bool heap) :
   _dcmdparser.add_dcmd_option(&_show_vslist);
   _dcmdparser.add_dcmd_option(&_show_chunkfreelist);
   _dcmdparser.add_dcmd_option(&_scale);
+  _dcmdparser.add_dcmd_option(&_purge);
 }
 
 void MetaspaceDCmd::execute(DCmdSource source, TRAPS) {
@@ -72,6 +75,25 @@ void MetaspaceDCmd::execute(DCmdSource source, TRAPS) {
       }
     }
   }
+  if (_purge.value()) {
+    // Uncommit free chunks, as is done after class unloading. Does not need
+    // to be at a safepoint; the chunk managers take the Metaspace_lock.
+    const size_t committed_before = MetaspaceUtils::committed_bytes();
+    ChunkManager* cm = ChunkManager::chunkmanager_nonclass();
+    if (cm != nullptr) {
+      cm->purge();
+    }
+    if (Metaspace::using_class_space()) {
+      cm = ChunkManager::chunkmanager_class();
+      if (cm != nullptr) {
+        cm->purge();
+      }
+    }
+    const size_t committed_after = MetaspaceUtils::committed_bytes();
+    output()->print_cr("Purged free chunks: committed " SIZE_FORMAT "K -> " SIZE_FORMAT "K, reclaimed " SIZE_FORMAT "K.",
+                       committed_before / K, committed_after / K,
+                       (committed_before - MIN2(committed_before, committed_after)) / K);
+  }
   if (_basic.value() == true) {
     if (_show_loaders.value() || _by_chunktype.value() || _by_spacetype.value() ||
         _show_vslist.value()) {
@@ -41,6 +41,7 @@ class MetaspaceDCmd : public DCmdWithParser {
   DCmdArgument<bool> _show_chunkfreelist;
   DCmdArgument<char*> _scale;
   DCmdArgument<bool> _show_classes;
+  DCmdArgument<bool> _purge;
 public:
   MetaspaceDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -57,7 +58,7 @@ class MetaspaceDCmd : public DCmdWithParser {
                         "monitor", nullptr};
     return p;
   }
-  static int num_arguments() { return 8; }
+  static int num_arguments() { return 9; }
   virtual void execute(DCmdSource source, TRAPS);
 };
 
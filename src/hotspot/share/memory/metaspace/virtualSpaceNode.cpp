@@ -113,6 +113,13 @@ bool VirtualSpaceNode::commit_range(MetaWord* p, size_t word_size) {
     vm_exit_out_of_memory(word_size * BytesPerWord, OOM_MMAP_ERROR, "Failed to commit metaspace.");
   }
 
+  if (MetaspaceUseTransparentHugePages) {
+    // The platform ignores this unless THPs are in use. Adjacent committed granules
+    // merge into one mapping, so khugepaged can collapse them once a full large page
+    // worth of metaspace is committed.
+    os::realign_memory((char*)p, word_size * BytesPerWord, os::large_page_size());
+  }
+
   if (AlwaysPreTouch) {
     os::pretouch_memory(p, p + word_size);
   }
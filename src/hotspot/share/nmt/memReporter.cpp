@@ -337,7 +337,11 @@ int MemDetailReporter::report_malloc_sites() {
       continue;
     }
     const NativeCallStack* stack = malloc_site->call_stack();
-    _stackprinter.print_stack(stack);
+    if (stack->is_empty()) {
+      out->print_cr("[no call stack captured, see NMTDetailStackSampleInterval]");
+    } else {
+      _stackprinter.print_stack(stack);
+    }
     MEMFLAGS flag = malloc_site->flag();
     assert(NMTUtil::flag_is_valid(flag) && flag != mtNone,
       "Must have a valid memory type");
@@ -49,6 +49,7 @@
 #endif
 
 NMT_TrackingLevel MemTracker::_tracking_level = NMT_unknown;
+THREAD_LOCAL uint MemTracker::_malloc_stack_sample_counter = 0;
 
 MemBaseline MemTracker::_baseline;
 
@@ -30,6 +30,7 @@
 #include "nmt/memoryFileTracker.hpp"
 #include "nmt/threadStackTracker.hpp"
 #include "nmt/virtualMemoryTracker.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadCritical.hpp"
 #include "utilities/debug.hpp"
@@ -39,6 +40,12 @@
                     NativeCallStack(0) : FAKE_CALLSTACK)
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : FAKE_CALLSTACK)
+// Like CALLER_PC, but for malloc entry points: the call stack is only captured
+// for sampled allocations, see NMTDetailStackSampleInterval.
+#define MALLOC_CALLER_PC ((MemTracker::tracking_level() == NMT_detail) ?  \
+                          (MemTracker::sample_malloc_stack() ?            \
+                           NativeCallStack(1) : NativeCallStack()) :      \
+                          FAKE_CALLSTACK)
 
 class MemBaseline;
 
@@ -66,6 +73,14 @@ class MemTracker : AllStatic {
     return _tracking_level;
   }
 
+  // Returns true if the current malloc call should capture its call stack.
+  static inline bool sample_malloc_stack() {
+    if (NMTDetailStackSampleInterval <= 1) {
+      return true;
+    }
+    return (++_malloc_stack_sample_counter % NMTDetailStackSampleInterval) == 0;
+  }
+
   static inline bool enabled() {
     return _tracking_level > NMT_off;
   }
@@ -275,6 +290,8 @@ class MemTracker : AllStatic {
  private:
   // Tracking level
   static NMT_TrackingLevel   _tracking_level;
+  // Per-thread malloc count for NMTDetailStackSampleInterval
+  static THREAD_LOCAL uint   _malloc_stack_sample_counter;
   // Stored baseline
   static MemBaseline      _baseline;
   // Query lock
@@ -54,6 +54,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/perfData.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/population_count.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/rotate_bits.hpp"
 #include "utilities/stack.inline.hpp"
@@ -170,17 +171,74 @@ bool Klass::search_secondary_supers(Klass* k) const {
   // This is necessary, since I am never in my own secondary_super list.
   if (this == k)
     return true;
+
+  if (UseSecondarySupersTable) {
+    // The hashed lookup does not write _secondary_super_cache, so
+    // concurrent checks against different interfaces do not fight over
+    // its cache line.
+    bool result = lookup_secondary_supers_table(k);
+    if (VerifySecondarySupers) {
+      bool linear_result = linear_search_secondary_supers(k);
+      if (linear_result != result) {
+        on_secondary_supers_verification_failure(k, const_cast<Klass*>(this), linear_result, result, "mismatch");
+      }
+    }
+    return result;
+  }
+
   // Scan the array-of-objects for a match
+  if (linear_search_secondary_supers(k)) {
+    ((Klass*)this)->set_secondary_super_cache(k);
+    return true;
+  }
+  return false;
+}
+
+bool Klass::linear_search_secondary_supers(const Klass* k) const {
   int cnt = secondary_supers()->length();
   for (int i = 0; i < cnt; i++) {
     if (secondary_supers()->at(i) == k) {
-      ((Klass*)this)->set_secondary_super_cache(k);
       return true;
     }
   }
   return false;
 }
 
+// C++ version of MacroAssembler::lookup_secondary_supers_table: probe the
+// home slot of k, then follow the run of occupied slots after it.
+bool Klass::lookup_secondary_supers_table(const Klass* k) const {
+  uintx bitmap = _bitmap;
+  if (bitmap == SECONDARY_SUPERS_BITMAP_FULL) {
+    return linear_search_secondary_supers(k);
+  }
+
+  int slot = k->hash_slot();
+  uintx shifted_bitmap = bitmap << (SECONDARY_SUPERS_TABLE_MASK - slot);
+  if ((shifted_bitmap >> SECONDARY_SUPERS_TABLE_MASK) == 0) {
+    // The home slot is empty, k cannot be present.
+    return false;
+  }
+
+  Array<Klass*>* secondaries = secondary_supers();
+  int length = secondaries->length();
+  int index = population_count(shifted_bitmap) - 1;
+  if (secondaries->at(index) == k) {
+    return true;
+  }
+
+  // Linear probing along the occupied slots following the home slot.
+  // The bitmap is not full, so the run ends at some empty slot.
+  uintx rotated_bitmap = rotate_right(bitmap, slot);
+  while ((rotated_bitmap & 2) != 0) {
+    index = (index + 1 == length) ? 0 : index + 1;
+    if (secondaries->at(index) == k) {
+      return true;
+    }
+    rotated_bitmap = rotate_right(rotated_bitmap, 1);
+  }
+  return false;
+}
+
 // Return self, except for abstract classes with exactly 1
 // implementor.  Then return the 1 concrete implementation.
 Klass *Klass::up_cast_abstract() {
@@ -542,6 +542,8 @@ class Klass : public Metadata {
   }
 
   bool search_secondary_supers(Klass* k) const;
+  bool linear_search_secondary_supers(const Klass* k) const;
+  bool lookup_secondary_supers_table(const Klass* k) const;
 
   // Find LCA in class hierarchy
   Klass *LCA( Klass *k );
@@ -335,6 +335,16 @@ class ProfileData : public ResourceObj {
     return DataLayout::compute_size_in_bytes(cell_count());
   }
 
+  // Return true if none of the cells of this data has been updated.
+  bool is_untouched() const {
+    for (int i = 0; i < cell_count(); i++) {
+      if (data()->cell_at(i) != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
 protected:
   // Low-level accessors for underlying data
   void set_intptr_at(int index, intptr_t value) {
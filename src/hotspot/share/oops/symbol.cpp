@@ -46,6 +46,7 @@ Symbol* Symbol::_vm_symbols[vmSymbols::number_of_symbols()];
 
 uint32_t Symbol::pack_hash_and_refcount(short hash, int refcount) {
   STATIC_ASSERT(PERM_REFCOUNT == ((1 << 16) - 1));
+  STATIC_ASSERT(HOT_REFCOUNT < PERM_REFCOUNT);
   assert(refcount >= 0, "negative refcount");
   assert(refcount <= PERM_REFCOUNT, "invalid refcount");
   uint32_t hi = hash;
@@ -285,7 +286,8 @@ void Symbol::print_as_field_external_type(outputStream *os) {
 
 // Increment refcount while checking for zero.  If the Symbol's refcount becomes zero
 // a thread could be concurrently removing the Symbol.  This is used during SymbolTable
-// lookup to avoid reviving a dead Symbol.
+// lookup to avoid reviving a dead Symbol.  A Symbol that becomes hot is made
+// permanent instead, see HOT_REFCOUNT.
 bool Symbol::try_increment_refcount() {
   uint32_t found = _hash_and_refcount;
   while (true) {
@@ -296,7 +298,9 @@ bool Symbol::try_increment_refcount() {
     } else if (refc == 0) {
       return false; // dead, can't revive.
     } else {
-      found = Atomic::cmpxchg(&_hash_and_refcount, old_value, old_value + 1);
+      uint32_t new_value = (refc + 1 >= HOT_REFCOUNT) ?
+        pack_hash_and_refcount(extract_hash(old_value), PERM_REFCOUNT) : old_value + 1;
+      found = Atomic::cmpxchg(&_hash_and_refcount, old_value, new_value);
       if (found == old_value) {
         return true; // successfully updated.
       }
@@ -101,6 +101,13 @@ class ClassLoaderData;
 #define PERM_REFCOUNT 0xffff
 #endif
 
+// A Symbol whose refcount reaches HOT_REFCOUNT is shared widely enough that
+// it is unlikely to ever be freed, so it is made permanent. This stops the
+// refcount updates from bouncing its cache line between threads.
+#ifndef HOT_REFCOUNT
+#define HOT_REFCOUNT 0x1000
+#endif
+
 class Symbol : public MetaspaceObj {
   friend class VMStructs;
   friend class SymbolTable;
@@ -29,6 +29,7 @@
 #include "opto/cfgnode.hpp"
 #include "opto/connode.hpp"
 #include "opto/machnode.hpp"
+#include "opto/memnode.hpp"
 #include "opto/movenode.hpp"
 #include "opto/mulnode.hpp"
 #include "opto/phaseX.hpp"
@@ -813,6 +814,12 @@ Node* OrINode::Ideal(PhaseGVN* phase, bool can_reshape) {
     Node* tn = phase->transform(and_a_b);
     return AddNode::make_not(phase, tn, T_INT);
   }
+
+  // Combine adjacent byte loads into a single wider load
+  Node* merged = LoadNode::merge_adjacent_byte_loads(phase, this);
+  if (merged != nullptr) {
+    return merged;
+  }
   return nullptr;
 }
 
@@ -887,6 +894,12 @@ Node* OrLNode::Ideal(PhaseGVN* phase, bool can_reshape) {
     return AddNode::make_not(phase, tn, T_LONG);
   }
 
+  // Combine adjacent byte loads into a single wider load
+  Node* merged = LoadNode::merge_adjacent_byte_loads(phase, this);
+  if (merged != nullptr) {
+    return merged;
+  }
+
   return nullptr;
 }
 
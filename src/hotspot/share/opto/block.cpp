@@ -1543,6 +1543,15 @@ extern "C" int trace_frequency_order(const void *p0, const void *p1) {
     return b1->is_connector() ? -1 : 1;
   }
 
+  // Traces of uncommon code (uncommon traps, slow-path calls, halts) go
+  // after all other traces, so that the cold code ends up together at the
+  // end of the method instead of being interleaved with the hot code.
+  bool uncommon0 = b0->has_uncommon_code();
+  bool uncommon1 = b1->has_uncommon_code();
+  if (uncommon0 != uncommon1) {
+    return uncommon1 ? -1 : 1;
+  }
+
   // Pull more frequently executed blocks to the beginning
   float freq0 = b0->_freq;
   float freq1 = b1->_freq;
@@ -332,6 +332,10 @@
   product(bool, LoopUnswitching, true,                                      \
           "Enable loop unswitching (a form of invariant test hoisting)")    \
                                                                             \
+  product(intx, LoopMaxUnswitch, 3, EXPERIMENTAL,                           \
+          "Maximum number of times a single loop may be unswitched")        \
+          range(0, 16)                                                      \
+                                                                            \
   develop(bool, TraceLoopUnswitching, false,                                \
           "Trace loop unswitching")                                         \
                                                                             \
@@ -359,6 +363,12 @@
   develop(bool, TraceMergeStores, false,                                    \
           "Trace creation of merged stores")                                \
                                                                             \
+  product(bool, MergeLoads, true, DIAGNOSTIC,                               \
+          "Combine adjacent byte array loads into a larger load")           \
+                                                                            \
+  develop(bool, TraceMergeLoads, false,                                     \
+          "Trace creation of merged loads")                                 \
+                                                                            \
   product_pd(bool, OptoBundling,                                            \
           "Generate nops to fill i-cache lines")                            \
                                                                             \
@@ -396,6 +406,10 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, false, EXPERIMENTAL,                \
+          "Profiling based inlining for all receivers of a call site "      \
+          "whose profile (see TypeProfileWidth) recorded every receiver")   \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -245,6 +245,35 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = nullptr;
         }
       }
+      if (receiver_method == nullptr && morphism > 2 && UsePolymorphicInlining &&
+          !too_many_traps_or_recompiles(caller, bci, Deoptimization::Reason_bimorphic)) {
+        // Every receiver seen at this site is in the profile. Chain one type check
+        // per receiver, most frequent first, and trap if none of them matches.
+        CallGenerator* cg = CallGenerator::for_uncommon_trap(callee, Deoptimization::Reason_bimorphic,
+                                                             Deoptimization::Action_maybe_recompile);
+        int remaining_count = 0;
+        for (int i = morphism - 1; i >= 0 && cg != nullptr; i--) {
+          ciMethod* target = callee->resolve_invoke(jvms->method()->holder(), profile.receiver(i));
+          CallGenerator* hit_cg = nullptr;
+          if (target != nullptr) {
+            hit_cg = this->call_generator(target, vtable_index, !call_does_dispatch, jvms,
+                                          allow_inline, prof_factor);
+          }
+          if (hit_cg == nullptr || (i > 0 && !hit_cg->is_inline() && UseOnlyInlinedBimorphic)) {
+            // Fall back to the bimorphic or virtual call shapes below
+            cg = nullptr;
+            break;
+          }
+          // Probability of receiver i given that the checks for receivers 0..i-1 failed
+          remaining_count += profile.receiver_count(i);
+          float hit_prob = MIN2((float)profile.receiver_count(i) / (float)remaining_count, (float)PROB_MAX);
+          trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), target, profile.receiver(i), site_count, profile.receiver_count(i));
+          cg = CallGenerator::for_predicted_call(profile.receiver(i), cg, hit_cg, hit_prob);
+        }
+        if (cg != nullptr) {
+          return cg;
+        }
+      }
       if (receiver_method == nullptr &&
           (have_major_receiver || morphism == 1 ||
            (morphism == 2 && UseBimorphicInlining))) {
@@ -129,6 +129,34 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   }
 }
 
+// Record in the compilation log the allocations that will not be scalar
+// replaced, so their allocation sites can be found with LogCompilation.
+static void log_not_scalar_replaced(CompileLog* log, GrowableArray<JavaObjectNode*>& java_objects_worklist) {
+  for (int next = 0; next < java_objects_worklist.length(); ++next) {
+    JavaObjectNode* ptn = java_objects_worklist.at(next);
+    Node* n = ptn->ideal_node();
+    if (!n->is_Allocate()) {
+      continue;
+    }
+    PointsToNode::EscapeState es = ptn->escape_state();
+    if (es == PointsToNode::NoEscape && ptn->scalar_replaceable()) {
+      continue;
+    }
+    const char* state = (es == PointsToNode::NoEscape)  ? "NoEscape" :
+                        (es == PointsToNode::ArgEscape) ? "ArgEscape" : "GlobalEscape";
+    const TypeKlassPtr* kt = n->in(AllocateNode::KlassNode)->bottom_type()->isa_klassptr();
+    if (kt != nullptr && kt->klass_is_exact()) {
+      log->head("not_scalar_replaced type='%d' escape='%s'", log->identify(kt->exact_klass()), state);
+    } else {
+      log->head("not_scalar_replaced escape='%s'", state);
+    }
+    for (JVMState* p = n->as_Allocate()->jvms(); p != nullptr; p = p->caller()) {
+      log->elem("jvms bci='%d' method='%d'", p->bci(), log->identify(p->method()));
+    }
+    log->tail("not_scalar_replaced");
+  }
+}
+
 bool ConnectionGraph::compute_escape() {
   Compile* C = _compile;
   PhaseGVN* igvn = _igvn;
@@ -320,6 +348,10 @@ bool ConnectionGraph::compute_escape() {
     find_scalar_replaceable_allocs(jobj_worklist);
   }
 
+  if (C->log() != nullptr) {
+    log_not_scalar_replaced(C->log(), java_objects_worklist);
+  }
+
   // alloc_worklist will be processed in reverse push order.
   // Therefore the reducible Phis will be processed for last and that's what we
   // want because by then the scalarizable inputs of the merge will already have
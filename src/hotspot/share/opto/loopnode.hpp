@@ -81,7 +81,6 @@ class LoopNode : public RegionNode {
          LoopNestInnerLoop     = 1<<15,
          LoopNestLongOuterLoop = 1<<16 };
   char _unswitch_count;
-  enum { _unswitch_max=3 };
 
   // Expected trip count from profile data
   float _profile_trip_cnt;
@@ -116,7 +115,7 @@ class LoopNode : public RegionNode {
   void mark_loop_nest_inner_loop() { _loop_flags |= LoopNestInnerLoop; }
   void mark_loop_nest_outer_loop() { _loop_flags |= LoopNestLongOuterLoop; }
 
-  int unswitch_max() { return _unswitch_max; }
+  int unswitch_max() { return (int)LoopMaxUnswitch; }
   int unswitch_count() { return _unswitch_count; }
 
   void set_unswitch_count(int val) {
@@ -710,6 +710,17 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   assert(r_loop == get_loop(iff), "sanity");
   // Always convert to CMOVE if all results are used only outside this loop.
   bool used_inside_loop = (r_loop == _ltree_root);
+  // SuperWord can turn float and double CMoves in innermost counted loops
+  // into VectorBlends, so do not let their scalar cost block if-conversion.
+  // That only holds if all Phis at the merge point are float or double.
+  bool vector_cmove = UseVectorCmov && UseSuperWord && r_loop->is_counted() && r_loop->is_innermost();
+  for (DUIterator_Fast imax, i = region->fast_outs(imax); i < imax && vector_cmove; i++) {
+    Node* out = region->fast_out(i);
+    if (out->is_Phi()) {
+      BasicType bt = out->as_Phi()->type()->basic_type();
+      vector_cmove = (bt == T_FLOAT || bt == T_DOUBLE);
+    }
+  }
 
   // Check profitability
   int cost = 0;
@@ -723,7 +734,7 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
     switch (bt) {
     case T_DOUBLE:
     case T_FLOAT:
-      if (C->use_cmove()) {
+      if (C->use_cmove() || vector_cmove) {
         continue; //TODO: maybe we want to add some cost
       }
       cost += Matcher::float_cmove_cost(); // Could be very expensive
@@ -816,7 +827,8 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   }
   // Check for highly predictable branch.  No point in CMOV'ing if
   // we are going to predict accurately all the time.
-  if (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
+  // A CMove that SuperWord vectorizes pays off even for predictable branches.
+  if ((C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) || vector_cmove) {
     //keep going
   } else if (iff->_prob < infrequent_prob ||
       iff->_prob > (1.0f - infrequent_prob))
@@ -47,6 +47,7 @@
 #include "opto/phaseX.hpp"
 #include "opto/regmask.hpp"
 #include "opto/rootnode.hpp"
+#include "opto/subnode.hpp"
 #include "opto/vectornode.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
@@ -3409,6 +3410,267 @@ void MergePrimitiveArrayStores::trace(const Node_List& merge_list, const Node* m
 }
 #endif
 
+
+// Replace a tree of Or nodes that assembles an int or long from adjacent byte loads with a
+// single wider load (and a ReverseBytes if the bytes are assembled in the opposite order).
+//
+// Example: _or = OrI
+//
+//   LoadUB[i+0]                          LoadUB[i+0]
+//   LoadUB[i+1] << 8                     LoadUB[i+1] << 8
+//   LoadUB[i+2] << 16    -->   LoadI[i+0]
+//   LoadB[i+3]  << 24
+//   OrI(OrI(OrI(...)))
+//
+// All loads must read the same memory state. Every byte load is legal at or below its own
+// control (RangeCheck), so the merged load is placed at the control of the byte load that is
+// dominated by all others: that control is below every RangeCheck the byte loads depended on.
+//
+class MergePrimitiveArrayLoads : public StackObj {
+private:
+  PhaseGVN* _phase;
+  Node* _or;
+  const BasicType _bt;   // T_INT or T_LONG
+  const int _num_bytes;
+
+public:
+  MergePrimitiveArrayLoads(PhaseGVN* phase, Node* or_node) :
+    _phase(phase),
+    _or(or_node),
+    _bt(or_node->Opcode() == Op_OrI ? T_INT : T_LONG),
+    _num_bytes(type2aelembytes(_bt)) {}
+
+  Node* run();
+
+private:
+  bool collect_leaves(Node_List& leaves) const;
+  LoadNode* parse_leaf(Node* leaf, jint& shift_out) const;
+  static bool is_byte_array_load(const LoadNode* load);
+  Node* find_merged_ctrl(LoadNode* const* loads) const;
+
+  DEBUG_ONLY( void trace(LoadNode* const* loads, const Node* merged_value) const; )
+};
+
+Node* MergePrimitiveArrayLoads::run() {
+  int opc = _or->Opcode();
+  assert(opc == Op_OrI || opc == Op_OrL, "precondition");
+
+  // Only start at the root of the tree: an Or whose only use is another Or of the same kind
+  // is handled when the root is processed.
+  if (_or->outcnt() == 1 && _or->unique_out()->Opcode() == opc) {
+    return nullptr;
+  }
+
+  ResourceMark rm;
+  Node_List leaves;
+  if (!collect_leaves(leaves) || (int)leaves.size() != _num_bytes) {
+    return nullptr;
+  }
+
+  // Sort the loads by the position of their byte in the result.
+  LoadNode* loads[8] = {};
+  for (uint i = 0; i < leaves.size(); i++) {
+    jint shift = 0;
+    LoadNode* load = parse_leaf(leaves.at(i), shift);
+    if (load == nullptr) { return nullptr; }
+    int pos = shift / BitsPerByte;
+    if (loads[pos] != nullptr) { return nullptr; }
+    loads[pos] = load;
+  }
+
+  Node* mem = loads[0]->in(MemNode::Memory);
+  for (int i = 1; i < _num_bytes; i++) {
+    if (loads[i]->in(MemNode::Memory) != mem) { return nullptr; }
+  }
+
+  // The bytes must be adjacent in memory, in ascending or descending order.
+  bool ascending = true;
+  bool descending = true;
+  for (int i = 0; i + 1 < _num_bytes && (ascending || descending); i++) {
+    ArrayPointer p_lo = ArrayPointer::make(_phase, loads[i]->in(MemNode::Address));
+    ArrayPointer p_hi = ArrayPointer::make(_phase, loads[i + 1]->in(MemNode::Address));
+    ascending  = ascending  && p_lo.is_adjacent_to_and_before(p_hi, 1);
+    descending = descending && p_hi.is_adjacent_to_and_before(p_lo, 1);
+  }
+  if (!ascending && !descending) {
+    return nullptr;
+  }
+  LoadNode* first_load = ascending ? loads[0] : loads[_num_bytes - 1];
+
+  // The least significant byte has the lowest address on little endian platforms.
+#ifdef VM_LITTLE_ENDIAN
+  bool needs_reverse = descending;
+#else
+  bool needs_reverse = ascending;
+#endif // VM_LITTLE_ENDIAN
+  int reverse_opc = (_bt == T_INT) ? Op_ReverseBytesI : Op_ReverseBytesL;
+  if (needs_reverse && !Matcher::match_rule_supported(reverse_opc)) {
+    return nullptr;
+  }
+
+  Node* ctrl = find_merged_ctrl(loads);
+  if (ctrl == nullptr) {
+    return nullptr;
+  }
+
+  LoadNode::ControlDependency dep = LoadNode::DependsOnlyOnTest;
+  for (int i = 0; i < _num_bytes; i++) {
+    if (!loads[i]->depends_only_on_test()) {
+      dep = LoadNode::Pinned;
+    }
+  }
+
+  const Type* rt = (_bt == T_INT) ? (const Type*)TypeInt::INT : (const Type*)TypeLong::LONG;
+  Node* merged_load = LoadNode::make(*_phase, ctrl, mem, first_load->in(MemNode::Address),
+                                     first_load->adr_type(), rt, _bt, MemNode::unordered, dep,
+                                     false /* require_atomic_access */, true /* unaligned */,
+                                     true /* mismatched */);
+  Node* merged_value = _phase->transform(merged_load);
+  if (needs_reverse) {
+    if (_bt == T_INT) {
+      merged_value = _phase->transform(new ReverseBytesINode(nullptr, merged_value));
+    } else {
+      merged_value = _phase->transform(new ReverseBytesLNode(nullptr, merged_value));
+    }
+  }
+
+  DEBUG_ONLY( if(TraceMergeLoads) { trace(loads, merged_value); } )
+
+  return merged_value;
+}
+
+// Flatten the Or tree below _or. Inner Or nodes must only be used inside the tree.
+bool MergePrimitiveArrayLoads::collect_leaves(Node_List& leaves) const {
+  int opc = _or->Opcode();
+  Node_List worklist;
+  worklist.push(_or);
+  while (worklist.size() > 0) {
+    Node* n = worklist.pop();
+    if (n->Opcode() == opc && (n == _or || n->outcnt() == 1)) {
+      worklist.push(n->in(1));
+      worklist.push(n->in(2));
+    } else {
+      leaves.push(n);
+    }
+    if ((int)(leaves.size() + worklist.size()) > _num_bytes) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Parse a leaf of the form:
+//
+//   int:   LoadUB            << shift     (or LoadB if shift == 24)
+//   long:  ConvI2L(LoadUB)   << shift     (or LoadB if shift == 56)
+//          AndL(ConvI2L(LoadB), 0xFF) << shift
+//
+// The shift is optional for the least significant byte.
+LoadNode* MergePrimitiveArrayLoads::parse_leaf(Node* leaf, jint& shift_out) const {
+  int bits = _num_bytes * BitsPerByte;
+  Node* n = leaf;
+  shift_out = 0;
+  if (n->Opcode() == (_bt == T_INT ? Op_LShiftI : Op_LShiftL) && n->in(2)->is_ConI()) {
+    if (n->outcnt() != 1) { return nullptr; }
+    shift_out = n->in(2)->get_int() & (bits - 1);
+    n = n->in(1);
+  }
+  if (shift_out % BitsPerByte != 0) {
+    return nullptr;
+  }
+  bool masked = false;
+  if (_bt == T_INT) {
+    if (n->Opcode() == Op_AndI && n->in(2)->find_int_con(0) == 0xFF) {
+      if (n->outcnt() != 1) { return nullptr; }
+      masked = true;
+      n = n->in(1);
+    }
+  } else {
+    if (n->Opcode() == Op_AndL && n->in(2)->find_long_con(0) == 0xFF) {
+      if (n->outcnt() != 1) { return nullptr; }
+      masked = true;
+      n = n->in(1);
+    }
+    if (n->Opcode() != Op_ConvI2L || n->outcnt() != 1) {
+      return nullptr;
+    }
+    n = n->in(1);
+  }
+  if (!n->is_Load() || n->outcnt() != 1) {
+    return nullptr;
+  }
+  LoadNode* load = n->as_Load();
+  // The sign bits of a LoadB only survive if they are masked off or shifted out.
+  if (!is_byte_array_load(load) ||
+      (load->Opcode() == Op_LoadB && !masked && shift_out != bits - BitsPerByte)) {
+    return nullptr;
+  }
+  return load;
+}
+
+bool MergePrimitiveArrayLoads::is_byte_array_load(const LoadNode* load) {
+  int opc = load->Opcode();
+  if (opc != Op_LoadB && opc != Op_LoadUB) {
+    return false;
+  }
+  if (!load->is_unordered() || load->is_unsafe_access() || load->is_mismatched_access()) {
+    return false;
+  }
+  const TypePtr* ptr_t = load->adr_type();
+  if (ptr_t == nullptr || ptr_t->isa_aryptr() == nullptr) {
+    return false;
+  }
+  BasicType bt = ptr_t->is_aryptr()->elem()->array_element_basic_type();
+  return is_java_primitive(bt) && type2aelembytes(bt) == 1;
+}
+
+// Find the control of the load that is dominated by the controls of all the other loads.
+Node* MergePrimitiveArrayLoads::find_merged_ctrl(LoadNode* const* loads) const {
+  for (int i = 0; i < _num_bytes; i++) {
+    Node* ctrl = loads[i]->in(MemNode::Control);
+    if (ctrl == nullptr) {
+      return nullptr;
+    }
+  }
+  for (int i = 0; i < _num_bytes; i++) {
+    Node* candidate = loads[i]->in(MemNode::Control);
+    bool dominated_by_all = true;
+    for (int j = 0; j < _num_bytes && dominated_by_all; j++) {
+      Node* other = loads[j]->in(MemNode::Control);
+      dominated_by_all = (other == candidate) || _phase->is_dominator(other, candidate);
+    }
+    if (dominated_by_all) {
+      return candidate;
+    }
+  }
+  return nullptr;
+}
+
+#ifdef ASSERT
+void MergePrimitiveArrayLoads::trace(LoadNode* const* loads, const Node* merged_value) const {
+  stringStream ss;
+  ss.print_cr("[TraceMergeLoads]: Replace");
+  for (int i = 0; i < _num_bytes; i++) {
+    loads[i]->dump("\n", false, &ss);
+  }
+  _or->dump("\n", false, &ss);
+  ss.print_cr("[TraceMergeLoads]: with");
+  merged_value->dump("\n", false, &ss);
+  tty->print("%s", ss.as_string());
+}
+#endif
+
+Node* LoadNode::merge_adjacent_byte_loads(PhaseGVN* phase, Node* or_node) {
+  if (!MergeLoads || !UseUnalignedAccesses) {
+    return nullptr;
+  }
+  if (!phase->C->post_loop_opts_phase()) {
+    phase->C->record_for_post_loop_opts_igvn(or_node);
+    return nullptr;
+  }
+  MergePrimitiveArrayLoads merge(phase, or_node);
+  return merge.run();
+}
 //------------------------------Ideal------------------------------------------
 // Change back-to-back Store(, p, x) -> Store(m, p, y) to Store(m, p, x).
 // When a store immediately follows a relevant allocation/initialization,
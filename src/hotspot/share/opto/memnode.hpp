@@ -235,6 +235,10 @@ class LoadNode : public MemNode {
                     bool require_atomic_access = false, bool unaligned = false, bool mismatched = false, bool unsafe = false,
                     uint8_t barrier_data = 0);
 
+  // Replace an OrI/OrL tree that assembles a value from adjacent byte array
+  // loads with a single wider load. Returns nullptr if there is no such tree.
+  static Node* merge_adjacent_byte_loads(PhaseGVN* phase, Node* or_node);
+
   virtual uint hash()   const;  // Check the type
 
   // Handle algebraic identities here.  If we have an identity, return the Node
@@ -663,6 +663,47 @@ bool VPointer::scaled_iv(Node* n) {
         return true;
       }
     }
+  } else if ((opc == Op_AddL || opc == Op_SubL) && !has_iv()) {
+    // MulLNode::Ideal turns a multiplication by a constant with two bits set,
+    // or by 2^n - 1, into two shifts, e.g. "x * 12L" into "(x << 3) + (x << 2)".
+    // Both terms must scale the iv without an invariant.
+    NOT_PRODUCT(Tracer::Depth dddd;)
+    VPointer tmp1(this);
+    VPointer tmp2(this);
+    NOT_PRODUCT(_tracer.scaled_iv_8(n, &tmp1);)
+
+    if (tmp1.scaled_iv(n->in(1)) && tmp1._invar == nullptr &&
+        tmp2.scaled_iv(n->in(2)) && tmp2._invar == nullptr) {
+      const jlong sign   = (opc == Op_AddL) ? 1 : -1;
+      const jlong scale  = (jlong)tmp1._scale  + sign * tmp2._scale;
+      const jlong offset = (jlong)tmp1._offset + sign * tmp2._offset;
+      if (scale != 0 && scale == (jint)scale && offset == (jint)offset) {
+        _scale   = (jint)scale;
+        _offset += (jint)offset;
+        NOT_PRODUCT(_tracer.scaled_iv_9(n, _scale, _offset, _invar);)
+        return true;
+      }
+    }
+  } else if (opc == Op_MulL && n->in(2)->is_Con()) {
+    // Long index scaled by an element size that is not a power of 2,
+    // e.g. MemorySegment accesses to an array of structs.
+    if (!has_iv()) {
+      NOT_PRODUCT(Tracer::Depth dddd;)
+      VPointer tmp(this);
+      NOT_PRODUCT(_tracer.scaled_iv_8(n, &tmp);)
+
+      if (tmp.scaled_iv_plus_offset(n->in(1)) && tmp._invar == nullptr) {
+        const jlong con    = n->in(2)->get_long();
+        const jlong scale  = (jlong)tmp._scale * con;
+        const jlong offset = (jlong)tmp._offset * con;
+        if (con == (jint)con && scale == (jint)scale && offset == (jint)offset) {
+          _scale   = (jint)scale;
+          _offset += (jint)offset;
+          NOT_PRODUCT(_tracer.scaled_iv_9(n, _scale, _offset, _invar);)
+          return true;
+        }
+      }
+    }
   }
   NOT_PRODUCT(_tracer.scaled_iv_10(n);)
   return false;
@@ -1036,13 +1077,13 @@ void VPointer::Tracer::scaled_iv_7(Node* n) {
 
 void VPointer::Tracer::scaled_iv_8(Node* n, VPointer* tmp) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print(" %d VPointer::scaled_iv: Op_LShiftL, creating tmp VPointer: ", n->_idx); tmp->print();
+    print_depth(); tty->print(" %d VPointer::scaled_iv: Op_%s, creating tmp VPointer: ", n->_idx, n->Name()); tmp->print();
   }
 }
 
 void VPointer::Tracer::scaled_iv_9(Node* n, int scale, int offset, Node* invar) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::scaled_iv: Op_LShiftL PASSED, setting _scale = %d, _offset = %d", n->_idx, scale, offset);
+    print_depth(); tty->print_cr(" %d VPointer::scaled_iv: Op_%s PASSED, setting _scale = %d, _offset = %d", n->_idx, n->Name(), scale, offset);
     print_depth(); tty->print_cr("  \\ VPointer::scaled_iv: in(1) [%d] is scaled_iv_plus_offset, in(2) [%d] used to scale: _scale = %d, _offset = %d",
     n->in(1)->_idx, n->in(2)->_idx, scale, offset);
     if (invar != nullptr) {
@@ -535,7 +535,18 @@ freeze_result Freeze<ConfigT>::try_freeze_fast() {
   DEBUG_ONLY(_fast_freeze_size = size_if_fast_freeze_available();)
   assert(_fast_freeze_size == 0, "");
 
-  stackChunkOop chunk = allocate_chunk(cont_size() + frame::metadata_words, _cont.argsize() + frame::metadata_words_at_top);
+  size_t stack_size = cont_size() + frame::metadata_words;
+  if (StackChunkAllocationSlack > 0) {
+    // Leave room below the frames so that the chunk can be reused by later
+    // freezes, unless that would make the chunk humongous.
+    size_t with_slack = stack_size + StackChunkAllocationSlack;
+    size_t with_slack_in_words = InstanceStackChunkKlass::cast(vmClasses::StackChunk_klass())->instance_size(with_slack);
+    if (CollectedHeap::stack_chunk_max_size() == 0 || with_slack_in_words < CollectedHeap::stack_chunk_max_size()) {
+      stack_size = with_slack;
+    }
+  }
+
+  stackChunkOop chunk = allocate_chunk(stack_size, _cont.argsize() + frame::metadata_words_at_top);
   if (freeze_fast_new_chunk(chunk)) {
     return freeze_ok;
   }
@@ -648,9 +659,12 @@ bool FreezeBase::freeze_fast_new_chunk(stackChunkOop chunk) {
   chunk->set_max_thawing_size(cont_size());
 
   // in a fresh chunk, we freeze *with* the bottom-most frame's stack arguments.
-  // They'll then be stored twice: in the chunk and in the parent chunk's top frame
-  const int chunk_start_sp = cont_size() + frame::metadata_words;
-  assert(chunk_start_sp == chunk->stack_size(), "");
+  // They'll then be stored twice: in the chunk and in the parent chunk's top frame.
+  // The chunk may be larger than needed, see StackChunkAllocationSlack; the
+  // frames are frozen at its bottom and the slack is left free above them.
+  const int chunk_start_sp = chunk->stack_size();
+  assert(chunk_start_sp >= cont_size() + frame::metadata_words, "");
+  assert(StackChunkAllocationSlack > 0 || chunk_start_sp == cont_size() + frame::metadata_words, "");
 
   DEBUG_ONLY(_orig_chunk_sp = chunk->start_address() + chunk_start_sp;)
 
@@ -1578,6 +1592,10 @@ static inline int freeze_internal(JavaThread* current, intptr_t* const sp) {
     log_develop_debug(continuations)("PINNED due to critical section/hold monitor");
     verify_continuation(cont.continuation());
     freeze_result res = entry->is_pinned() ? freeze_pinned_cs : freeze_pinned_monitor;
+    if (res == freeze_pinned_monitor) {
+      log_debug(continuations)("Freeze pinned by monitors, thread: " INTPTR_FORMAT " held: " INT64_FORMAT " JNI: " INT64_FORMAT,
+                               p2i(current), (int64_t)current->held_monitor_count(), (int64_t)current->jni_monitor_count());
+    }
     log_develop_trace(continuations)("=== end of freeze (fail %d)", res);
     return res;
   }
@@ -43,6 +43,10 @@ const char* CPUTimeGroups::to_string(CPUTimeType val) {
       return "vm";
     case CPUTimeType::conc_dedup:
       return "conc_dedup";
+    case CPUTimeType::compiler_c1:
+      return "compiler_c1";
+    case CPUTimeType::compiler_c2:
+      return "compiler_c2";
     default:
       ShouldNotReachHere();
       return "";
@@ -43,6 +43,8 @@ class CPUTimeGroups : public AllStatic {
     gc_service,
     vm,
     conc_dedup,
+    compiler_c1,
+    compiler_c2,
     COUNT,
   };
 
@@ -1036,9 +1036,10 @@ class DeoptimizeMarkedClosure : public HandshakeClosure {
 
 void Deoptimization::deoptimize_all_marked() {
   ResourceMark rm;
+  jlong start_ns = os::javaTimeNanos();
 
   // Make the dependent methods not entrant
-  CodeCache::make_marked_nmethods_deoptimized();
+  int deoptimized = CodeCache::make_marked_nmethods_deoptimized();
 
   DeoptimizeMarkedClosure deopt;
   if (SafepointSynchronize::is_at_safepoint()) {
@@ -1046,6 +1047,10 @@ void Deoptimization::deoptimize_all_marked() {
   } else {
     Handshake::execute(&deopt);
   }
+
+  log_debug(deoptimization)("Deoptimized %d marked nmethods in " JLONG_FORMAT " ns%s",
+                            deoptimized, os::javaTimeNanos() - start_ns,
+                            SafepointSynchronize::is_at_safepoint() ? " at safepoint" : "");
 }
 
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
@@ -576,6 +576,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
+  product(uint, NMTDetailStackSampleInterval, 1, DIAGNOSTIC,               \
+          "With NativeMemoryTracking=detail, capture the call stack for "   \
+          "only one in this many malloc calls per thread. Allocations "     \
+          "without a stack are reported under an empty call site")          \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, LogCompilation, false, DIAGNOSTIC,                          \
           "Log compilation activity in detail to LogFile")                  \
                                                                             \
@@ -1132,6 +1138,11 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseInterpreter, true,                                       \
           "Use interpreter for non-compiled methods")                       \
                                                                             \
+  product(int, OopMapCacheSize, 32, EXPERIMENTAL,                           \
+          "Number of entries in the per-class cache of interpreter oop "    \
+          "maps")                                                           \
+          range(8, 4096)                                                    \
+                                                                            \
   develop(bool, UseFastSignatureHandlers, true,                             \
           "Use fast signature handlers for native calls")                   \
                                                                             \
@@ -1411,6 +1422,11 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, MetaspaceGuardAllocations, false,                           \
           "Metapace allocations are guarded.")                              \
                                                                             \
+  product(bool, MetaspaceUseTransparentHugePages, false, EXPERIMENTAL,      \
+          "Advise the kernel to back committed metaspace with transparent " \
+          "huge pages. Only effective with UseTransparentHugePages and "    \
+          "THP mode 'madvise'.")                                            \
+                                                                            \
   product(uintx, MinHeapFreeRatio, 40, MANAGEABLE,                          \
           "The minimum percentage of heap free after GC to avoid expansion."\
           " For most GCs this applies to the old generation. In G1 and"     \
@@ -1920,6 +1936,12 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, UseContinuationFastPath, true,                              \
           "Use fast-path frame walking in continuations")                   \
                                                                             \
+  product(int, StackChunkAllocationSlack, 0, EXPERIMENTAL,                  \
+          "Extra words allocated in new stack chunks on the fast freeze "   \
+          "path, so that later freezes of deeper stacks can reuse the "     \
+          "chunk instead of allocating a new one")                          \
+          range(0, 64*K)                                                    \
+                                                                            \
   develop(int, VerifyMetaspaceInterval, DEBUG_ONLY(500) NOT_DEBUG(0),       \
                "Run periodic metaspace verifications (0 - none, "           \
                "1 - always, >1 every nth interval)")                        \
@@ -1967,6 +1989,11 @@ const int ObjectAlignmentInBytes = 8;
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
                                                                             \
+  product(size_t, TrimNativeHeapMinFreeBytes, 0, EXPERIMENTAL,              \
+          "Periodic native heap trimming is skipped if the C-heap holds "   \
+          "less than this many free bytes. Only evaluated on glibc. A "     \
+          "value of 0 (default) trims unconditionally.")                    \
+                                                                            \
   develop(bool, SimulateFullAddressSpace, false,                            \
           "Simulates a very populated, fragmented address space; no "       \
           "targeted reservations will succeed.")                            \
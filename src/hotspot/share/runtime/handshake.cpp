@@ -267,6 +267,16 @@ class VM_HandshakeAllThreads: public VM_Operation {
     // Keeps count on how many of own emitted handshakes
     // this thread execute.
     int emitted_handshakes_executed = 0;
+
+    // Threads that are known to be done with our operation are dropped from
+    // the set that is swept on every round, so that with many threads only
+    // the stragglers keep being polled. The threads stay protected by jtiwh.
+    ResourceMark rm;
+    uint pending_length = jtiwh.length();
+    JavaThread** pending = NEW_RESOURCE_ARRAY(JavaThread*, pending_length);
+    for (uint i = 0; i < pending_length; i++) {
+      pending[i] = jtiwh.list()->thread_at(i);
+    }
     do {
       // Check if handshake operation has timed out
       check_handshake_timeout(start_time_ns, _op);
@@ -274,8 +284,9 @@ class VM_HandshakeAllThreads: public VM_Operation {
       // Have VM thread perform the handshake operation for blocked threads.
       // Observing a blocked state may of course be transient but the processing is guarded
       // by mutexes and we optimistically begin by working on the blocked threads
-      jtiwh.rewind();
-      for (JavaThread* thr = jtiwh.next(); thr != nullptr; thr = jtiwh.next()) {
+      uint kept = 0;
+      for (uint i = 0; i < pending_length; i++) {
+        JavaThread* thr = pending[i];
         // A new thread on the ThreadsList will not have an operation,
         // hence it is skipped in handshake_try_process.
         HandshakeState::ProcessResult pr = thr->handshake_state()->try_process(_op);
@@ -283,7 +294,13 @@ class VM_HandshakeAllThreads: public VM_Operation {
         if (pr == HandshakeState::_succeeded) {
           emitted_handshakes_executed++;
         }
+        // Our operation is never added again once it has been removed, so a
+        // thread that executed it or has no operation at all is finished.
+        if (pr != HandshakeState::_succeeded && pr != HandshakeState::_no_operation) {
+          pending[kept++] = thr;
+        }
       }
+      pending_length = kept;
       hsy.process();
     } while (!_op->is_completed());
 
@@ -56,6 +56,7 @@
 #include "oops/instanceOop.hpp"
 #include "oops/klassVtable.hpp"
 #include "oops/method.hpp"
+#include "oops/methodData.hpp"
 #include "oops/objArrayOop.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/symbol.hpp"
@@ -131,18 +132,28 @@ static void print_method_profiling_data() {
 
     int count = collected_profiled_methods->length();
     int total_size = 0;
+    int total_untouched_size = 0;
     if (count > 0) {
       for (int index = 0; index < count; index++) {
         Method* m = collected_profiled_methods->at(index);
+        MethodData* mdo = m->method_data();
 
         // Instead of taking tty lock, we collect all lines into a string stream
         // and then print them all at once.
         ResourceMark rm2;
         stringStream ss;
 
+        // Profile entries that were never updated are footprint without benefit.
+        int untouched_size = 0;
+        for (ProfileData* data = mdo->first_data(); mdo->is_valid(data); data = mdo->next_data(data)) {
+          if (data->is_untouched()) {
+            untouched_size += data->size_in_bytes();
+          }
+        }
+
         ss.print_cr("------------------------------------------------------------------------");
         m->print_invocation_count(&ss);
-        ss.print_cr("  mdo size: %d bytes", m->method_data()->size_in_bytes());
+        ss.print_cr("  mdo size: %d bytes (untouched profile entries: %d bytes)", mdo->size_in_bytes(), untouched_size);
         ss.cr();
         // Dump data on parameters if any
         if (m->method_data() != nullptr && m->method_data()->parameters_type_data() != nullptr) {
@@ -151,10 +162,11 @@ static void print_method_profiling_data() {
         }
         m->print_codes_on(&ss);
         tty->print("%s", ss.as_string()); // print all at once
-        total_size += m->method_data()->size_in_bytes();
+        total_size += mdo->size_in_bytes();
+        total_untouched_size += untouched_size;
       }
       tty->print_cr("------------------------------------------------------------------------");
-      tty->print_cr("Total MDO size: %d bytes", total_size);
+      tty->print_cr("Total MDO size: %d bytes (untouched profile entries: %d bytes)", total_size, total_untouched_size);
     }
   }
 }
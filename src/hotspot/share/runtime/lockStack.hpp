@@ -42,7 +42,7 @@ class LockStack {
   friend class VMStructs;
   JVMCI_ONLY(friend class JVMCIVMStructs;)
 public:
-  static const int CAPACITY = 8;
+  static const int CAPACITY = 16;
 private:
 
   // TODO: It would be very useful if JavaThread::lock_stack_offset() and friends were constexpr,
@@ -1857,6 +1857,7 @@ int ObjectMonitor::Knob_SpinLimit    = 5000;   // derived by an external tool
 
 static int Knob_Bonus               = 100;     // spin success bonus
 static int Knob_Penalty             = 200;     // spin failure penalty
+static int Knob_PenaltyShift        = 3;       // spin failure multiplicative penalty
 static int Knob_Poverty             = 1000;
 static int Knob_FixedSpin           = 0;
 static int Knob_PreSpin             = 10;      // 20-100 likely better, but it's not better in my testing.
@@ -1874,13 +1875,13 @@ inline static int adjust_up(int spin_duration) {
 }
 
 inline static int adjust_down(int spin_duration) {
-  // TODO: Use an AIMD-like policy to adjust _SpinDuration.
-  // AIMD is globally stable.
+  // Use an AIMD-like policy to adjust _SpinDuration: success adds a fixed
+  // bonus, failure removes a fraction of the current duration. AIMD is
+  // globally stable, and monitors with long hold times stop spinning after
+  // a few failed full-length spins instead of after tens of them.
   int x = spin_duration;
   if (x > 0) {
-    // Consider an AIMD scheme like: x -= (x >> 3) + 100
-    // This is globally sample and tends to damp the response.
-    x -= Knob_Penalty;
+    x -= (x >> Knob_PenaltyShift) + Knob_Penalty;
     if (x < 0) { x = 0; }
     return x;
   } else {
@@ -2121,9 +2122,9 @@ inline void ObjectMonitor::DequeueSpecificWaiter(ObjectWaiter* node) {
 
 // -----------------------------------------------------------------------------
 // PerfData support
-PerfCounter * ObjectMonitor::_sync_ContendedLockAttempts       = nullptr;
-PerfCounter * ObjectMonitor::_sync_FutileWakeups               = nullptr;
-PerfCounter * ObjectMonitor::_sync_Parks                       = nullptr;
+PerfStripedCounter * ObjectMonitor::_sync_ContendedLockAttempts = nullptr;
+PerfStripedCounter * ObjectMonitor::_sync_FutileWakeups         = nullptr;
+PerfStripedCounter * ObjectMonitor::_sync_Parks                 = nullptr;
 PerfCounter * ObjectMonitor::_sync_Notifications               = nullptr;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = nullptr;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = nullptr;
@@ -2151,6 +2152,12 @@ void ObjectMonitor::Initialize() {
     n = PerfDataManager::create_counter(SUN_RT, #n, PerfData::U_Events,  \
                                         CHECK);                          \
   }
+#define NEWPERFSTRIPEDCOUNTER(n)                                         \
+  {                                                                      \
+    n = new PerfStripedCounter();                                        \
+    PerfDataManager::create_counter(SUN_RT, #n, PerfData::U_Events, n,   \
+                                    CHECK);                              \
+  }
 #define NEWPERFVARIABLE(n)                                                \
   {                                                                       \
     n = PerfDataManager::create_variable(SUN_RT, #n, PerfData::U_Events,  \
@@ -2158,12 +2165,15 @@ void ObjectMonitor::Initialize() {
   }
     NEWPERFCOUNTER(_sync_Inflations);
     NEWPERFCOUNTER(_sync_Deflations);
-    NEWPERFCOUNTER(_sync_ContendedLockAttempts);
-    NEWPERFCOUNTER(_sync_FutileWakeups);
-    NEWPERFCOUNTER(_sync_Parks);
+    // Bumped by every contending thread; stripe these to avoid making
+    // contention worse by bouncing the counter cache lines.
+    NEWPERFSTRIPEDCOUNTER(_sync_ContendedLockAttempts);
+    NEWPERFSTRIPEDCOUNTER(_sync_FutileWakeups);
+    NEWPERFSTRIPEDCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
+#undef NEWPERFSTRIPEDCOUNTER
 #undef NEWPERFVARIABLE
   }
 
@@ -203,9 +203,9 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
       }                                             \
     } while (0)
 
-  static PerfCounter * _sync_ContendedLockAttempts;
-  static PerfCounter * _sync_FutileWakeups;
-  static PerfCounter * _sync_Parks;
+  static PerfStripedCounter * _sync_ContendedLockAttempts;
+  static PerfStripedCounter * _sync_FutileWakeups;
+  static PerfStripedCounter * _sync_Parks;
   static PerfCounter * _sync_Notifications;
   static PerfCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
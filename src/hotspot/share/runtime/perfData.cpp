@@ -28,12 +28,14 @@
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
+#include "runtime/thread.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -212,6 +214,31 @@ void PerfLongVariant::sample() {
   }
 }
 
+PerfStripedCounter::PerfStripedCounter() {
+  for (int i = 0; i < stripe_count; i++) {
+    _stripes[i]._value = 0;
+  }
+}
+
+int PerfStripedCounter::stripe_index() {
+  // Threads are allocated far apart, so dropping the low bits of the
+  // Thread* gives a cheap and stable spread over the stripes.
+  uintptr_t t = (uintptr_t)Thread::current_or_null();
+  return (int)((t >> 7) % stripe_count);
+}
+
+void PerfStripedCounter::inc(jlong val) {
+  Atomic::add(&_stripes[stripe_index()]._value, val, memory_order_relaxed);
+}
+
+jlong PerfStripedCounter::take_sample() {
+  jlong sum = 0;
+  for (int i = 0; i < stripe_count; i++) {
+    sum += Atomic::load(&_stripes[i]._value);
+  }
+  return sum;
+}
+
 PerfByteArray::PerfByteArray(CounterNS ns, const char* namep, Units u,
                              Variability v, jint length)
                             : PerfData(ns, namep, u, v), _length(length) {
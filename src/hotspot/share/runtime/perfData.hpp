@@ -350,6 +350,42 @@ class PerfLongSampleHelper : public CHeapObj<mtInternal> {
     virtual jlong take_sample() = 0;
 };
 
+/*
+ * PerfStripedCounter is a PerfLongSampleHelper for monotonic counters that
+ * many threads update concurrently. Updates are spread over cache line
+ * padded stripes selected by the current thread, and the stripes are summed
+ * into the backing PerfLongCounter when the StatSampler takes a sample. The
+ * hsperfdata layout is unchanged, but readers of the PerfMemory region see
+ * a value that may lag by up to PerfDataSamplingInterval.
+ *
+ * Example:
+ *
+ *   PerfStripedCounter* foo = new PerfStripedCounter();
+ *   PerfDataManager::create_counter(SUN_RT, "foo", PerfData::U_Events,
+ *                                   foo, CHECK);
+ *   ...
+ *   foo->inc();
+ */
+class PerfStripedCounter : public PerfLongSampleHelper {
+  private:
+    static const int stripe_count = 16;
+
+    struct Stripe {
+      volatile jlong _value;
+      char _pad[DEFAULT_PADDING_SIZE - sizeof(jlong)];
+    };
+
+    Stripe _stripes[stripe_count];
+
+    static int stripe_index();
+
+  public:
+    PerfStripedCounter();
+
+    void inc(jlong val = 1);
+    jlong take_sample() override;
+};
+
 /*
  * PerfLong is the base class for the various Long PerfData subtypes.
  * it contains implementation details that are common among its derived
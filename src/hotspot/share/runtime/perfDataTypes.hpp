@@ -32,6 +32,7 @@
 // following types, include this file instead of perfData.hpp.
 
 class PerfLongSampleHelper;
+class PerfStripedCounter;
 class PerfLongConstant;
 class PerfLongCounter;
 class PerfLongVariable;
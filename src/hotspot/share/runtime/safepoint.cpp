@@ -185,6 +185,51 @@ static void assert_list_is_valid(const ThreadSafepointState* tss_head, int still
 }
 #endif // ASSERT
 
+// Histogram of the time it took each thread that was still running when the
+// safepoint was armed to stop, measured from the start of the safepoint.
+// Only collected when -Xlog:safepoint=debug is enabled.
+class SafepointSyncHistogram : public StackObj {
+  static const int NumBuckets = 6;
+  uint        _buckets[NumBuckets];
+  JavaThread* _slowest;
+  jlong       _slowest_ns;
+
+  static int bucket_for(jlong ns) {
+    // <10us, <100us, <1ms, <10ms, <100ms, >=100ms
+    jlong limit = 10 * (NANOUNITS / MICROUNITS);
+    for (int i = 0; i < NumBuckets - 1; i++) {
+      if (ns < limit) {
+        return i;
+      }
+      limit *= 10;
+    }
+    return NumBuckets - 1;
+  }
+
+public:
+  SafepointSyncHistogram() : _buckets(), _slowest(nullptr), _slowest_ns(0) {}
+
+  void record(JavaThread* thread, jlong ns) {
+    _buckets[bucket_for(ns)]++;
+    if (ns >= _slowest_ns) {
+      _slowest = thread;
+      _slowest_ns = ns;
+    }
+  }
+
+  void print() const {
+    if (_slowest == nullptr) {
+      return;
+    }
+    ResourceMark rm;
+    log_debug(safepoint)("Time to safepoint of running threads: "
+                         "<10us: %u, <100us: %u, <1ms: %u, <10ms: %u, <100ms: %u, >=100ms: %u, "
+                         "slowest: \"%s\" " INTPTR_FORMAT " (" JLONG_FORMAT " ns)",
+                         _buckets[0], _buckets[1], _buckets[2], _buckets[3], _buckets[4], _buckets[5],
+                         _slowest->name(), p2i(_slowest), _slowest_ns);
+  }
+};
+
 static void back_off(int64_t start_time) {
   // We start with fine-grained nanosleeping until a millisecond has
   // passed, at which point we resort to plain naked_short_sleep.
@@ -235,18 +280,25 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
 
+  const bool record_histogram = log_is_enabled(Debug, safepoint);
+  SafepointSyncHistogram histogram;
+
   do {
     // Check if this has taken too long:
     if (SafepointTimeout && safepoint_limit_time < os::javaTimeNanos()) {
       print_safepoint_timeout();
     }
 
+    const jlong round_ns = record_histogram ? os::javaTimeNanos() - SafepointTracing::start_of_safepoint() : 0;
     p_prev = &tss_head;
     ThreadSafepointState *cur_tss = tss_head;
     while (cur_tss != nullptr) {
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        if (record_histogram) {
+          histogram.record(cur_tss->thread(), round_ns);
+        }
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -269,6 +321,10 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   assert(tss_head == nullptr, "Must be empty");
 
+  if (record_histogram) {
+    histogram.print();
+  }
+
   return iterations;
 }
 
@@ -97,6 +97,7 @@ class ObjectMonitorDeflationSafepointer : public StackObj {
     : _current(current), _log(log) {}
 
   void block_for_safepoint(const char* op_name, const char* count_name, size_t counter);
+  void report_progress(const char* op_name, size_t scanned, const char* count_name, size_t counter);
 };
 
 // Walk the in-use list and unlink deflated ObjectMonitors.
@@ -105,6 +106,7 @@ size_t MonitorList::unlink_deflated(size_t deflated_count,
                                     GrowableArray<ObjectMonitor*>* unlinked_list,
                                     ObjectMonitorDeflationSafepointer* safepointer) {
   size_t unlinked_count = 0;
+  size_t scanned = 0;
   ObjectMonitor* prev = nullptr;
   ObjectMonitor* m = Atomic::load_acquire(&_head);
 
@@ -169,6 +171,7 @@ size_t MonitorList::unlink_deflated(size_t deflated_count,
 
     // Must check for a safepoint/handshake and honor it.
     safepointer->block_for_safepoint("unlinking", "unlinked_count", unlinked_count);
+    safepointer->report_progress("unlinking", ++scanned, "unlinked_count", unlinked_count);
   }
 
 #ifdef ASSERT
@@ -1664,6 +1667,7 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* inflating_thread, oo
 size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer) {
   MonitorList::Iterator iter = _in_use_list.iterator();
   size_t deflated_count = 0;
+  size_t scanned = 0;
 
   while (iter.has_next()) {
     if (deflated_count >= (size_t)MonitorDeflationMax) {
@@ -1676,6 +1680,7 @@ size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointe
 
     // Must check for a safepoint/handshake and honor it.
     safepointer->block_for_safepoint("deflation", "deflated_count", deflated_count);
+    safepointer->report_progress("deflation", ++scanned, "deflated_count", deflated_count);
   }
 
   return deflated_count;
@@ -1782,6 +1787,20 @@ class ObjectMonitorDeflationLogging: public StackObj {
     }
   }
 
+  // Long walks of a large in-use list are otherwise silent between begin and
+  // end unless a safepoint interrupts them, so report every ProgressInterval
+  // visited monitors at debug level.
+  static const size_t ProgressInterval = 64 * K;
+
+  void progress(const char* op_name, size_t scanned, const char* cnt_name, size_t cnt) {
+    if ((scanned % ProgressInterval) == 0 && _debug.is_enabled()) {
+      _debug.print_cr("%s progress: scanned=" SIZE_FORMAT ", %s=" SIZE_FORMAT
+                      ", in_use_list stats: ceiling=" SIZE_FORMAT ", count="
+                      SIZE_FORMAT ", max=" SIZE_FORMAT,
+                      op_name, scanned, cnt_name, cnt, ceiling(), count(), max());
+    }
+  }
+
   void after_block_for_safepoint(const char* op_name) {
     if (_stream != nullptr) {
       _stream->print_cr("resuming %s: in_use_list stats: ceiling=" SIZE_FORMAT
@@ -1808,6 +1827,11 @@ void ObjectMonitorDeflationSafepointer::block_for_safepoint(const char* op_name,
   _log->after_block_for_safepoint(op_name);
 }
 
+void ObjectMonitorDeflationSafepointer::report_progress(const char* op_name, size_t scanned,
+                                                        const char* count_name, size_t counter) {
+  _log->progress(op_name, scanned, count_name, counter);
+}
+
 // This function is called by the MonitorDeflationThread to deflate
 // ObjectMonitors.
 size_t ObjectSynchronizer::deflate_idle_monitors() {
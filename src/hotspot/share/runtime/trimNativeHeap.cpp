@@ -38,6 +38,9 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/vmError.hpp"
+#if defined(LINUX) && defined(__GLIBC__)
+#include "os_linux.hpp"
+#endif
 
 class NativeHeapTrimmerThread : public NamedThread {
 
@@ -53,6 +56,7 @@ class NativeHeapTrimmerThread : public NamedThread {
 
   // Statistics
   uint64_t _num_trims_performed;
+  uint64_t _num_trims_skipped;
 
   bool is_suspended() const {
     assert(_lock->is_locked(), "Must be");
@@ -132,10 +136,36 @@ class NativeHeapTrimmerThread : public NamedThread {
     }
   }
 
+  // Returns true if the native heap holds enough free memory to make a trim worthwhile.
+  // Without a way to sample the allocator, we always trim.
+  bool should_trim() {
+#if defined(LINUX) && defined(__GLIBC__)
+    if (TrimNativeHeapMinFreeBytes > 0) {
+      os::Linux::glibc_mallinfo mi;
+      bool might_have_wrapped = false;
+      os::Linux::get_mallinfo(&mi, &might_have_wrapped);
+      const size_t free_bytes = mi.fordblks;
+      if (!might_have_wrapped && free_bytes < TrimNativeHeapMinFreeBytes) {
+        _num_trims_skipped++;
+        log_debug(trimnative)("Periodic Trim skipped (" UINT64_FORMAT "): free " PROPERFMT
+                              ", in use " PROPERFMT ", releasable at top " PROPERFMT,
+                              _num_trims_skipped, PROPERFMTARGS(free_bytes),
+                              PROPERFMTARGS(mi.uordblks), PROPERFMTARGS(mi.keepcost));
+        return false;
+      }
+    }
+#endif
+    return true;
+  }
+
   // Execute the native trim, log results.
   void execute_trim_and_log(double t1) {
     assert(os::can_trim_native_heap(), "Unexpected");
 
+    if (!should_trim()) {
+      return;
+    }
+
     os::size_change_t sc = { 0, 0 };
     LogTarget(Info, trimnative) lt;
     const bool logging_enabled = lt.is_enabled();
@@ -167,7 +197,8 @@ class NativeHeapTrimmerThread : public NamedThread {
     _lock(new (std::nothrow) PaddedMonitor(Mutex::nosafepoint, "NativeHeapTrimmer_lock")),
     _stop(false),
     _suspend_count(0),
-    _num_trims_performed(0)
+    _num_trims_performed(0),
+    _num_trims_skipped(0)
   {
     set_name("Native Heap Trimmer");
     if (os::create_thread(this, os::vm_thread)) {
@@ -211,17 +242,20 @@ class NativeHeapTrimmerThread : public NamedThread {
 
   void print_state(outputStream* st) const {
     int64_t num_trims = 0;
+    int64_t num_skipped = 0;
     bool stopped = false;
     uint16_t suspenders = 0;
     {
       // Don't pull lock during error reporting
       ConditionalMutexLocker ml(_lock, !VMError::is_error_reported(), Mutex::_no_safepoint_check_flag);
       num_trims = _num_trims_performed;
+      num_skipped = _num_trims_skipped;
       stopped = _stop;
       suspenders = _suspend_count;
     }
-    st->print_cr("Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d",
-                 num_trims, suspenders, stopped);
+    st->print_cr("Trims performed: " UINT64_FORMAT ", skipped: " UINT64_FORMAT
+                 ", current suspend count: %d, stopped: %d",
+                 num_trims, num_skipped, suspenders, stopped);
   }
 
 }; // NativeHeapTrimmer
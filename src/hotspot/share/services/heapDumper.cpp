@@ -2626,6 +2626,17 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     timer()->start();
   }
 
+  // Parallel dumps stage segment files next to the target and merge them
+  // afterwards. A pipe, FIFO or device can only be written sequentially,
+  // and staging would need local disk, so stream a serial dump into it.
+  if (num_dump_threads > 1) {
+    struct stat st;
+    if (os::stat(path, &st) == 0 && (st.st_mode & S_IFMT) != S_IFREG) {
+      log_info(heapdump)("%s is not a regular file, dumping serially", path);
+      num_dump_threads = 1;
+    }
+  }
+
   if (_oome && num_dump_threads > 1) {
     // Each additional parallel writer requires several MB of internal memory
     // (DumpWriter buffer, DumperClassCacheTable, GZipCompressor buffers).
@@ -33,6 +33,12 @@
 #include "ByteGray.h"
 #include "ByteIndexed.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define INTARGBPRE_SRCOVER_SSE2
+#include <string.h>
+#include <emmintrin.h>
+#endif
+
 /*
  * This file declares, registers, and defines the various graphics
  * primitive loops to manipulate surfaces of type "IntArgbPre".
@@ -163,12 +169,173 @@ DEFINE_SRCOVER_MASKFILL(IntArgbPre, 4ByteArgb)
 
 DEFINE_ALPHA_MASKFILL(IntArgbPre, 4ByteArgb)
 
-DEFINE_SRCOVER_MASKBLIT(IntArgb, IntArgbPre, 4ByteArgb)
+#ifdef INTARGBPRE_SRCOVER_SSE2
 
-DEFINE_ALPHA_MASKBLIT(IntArgb, IntArgbPre, 4ByteArgb)
+/*
+ * On x86_64, where SSE2 is always available, the SrcOver MaskBlit loops
+ * onto IntArgbPre are done four pixels at a time.  For properly
+ * premultiplied pixels the results are the same as those of
+ * DEFINE_SRCOVER_MASKBLIT: mul8table[a][b] is exactly round(a * b / 255),
+ * which is what MUL8_SSE2 computes, and the terms the scalar loop skips
+ * for transparent or opaque pixels evaluate to identity operations here.
+ */
+
+/* round(a * b / 255) in each 16-bit lane, for a and b in [0, 255] */
+static __m128i MUL8_SSE2(__m128i a, __m128i b)
+{
+    __m128i p = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(p, _mm_srli_epi16(p, 8)), 8);
+}
+
+/* Broadcast the alpha of each of the two pixels held in 16-bit lanes */
+static __m128i AlphaOf2Pixels_SSE2(__m128i pix)
+{
+    pix = _mm_shufflelo_epi16(pix, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_shufflehi_epi16(pix, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+/*
+ * SrcOver for two pixels held in 16-bit lanes; pathA holds the (extra
+ * alpha adjusted) coverage of each pixel in all four of its lanes.
+ */
+static __m128i SrcOver2Pixels_SSE2(__m128i src, __m128i dst,
+                                   __m128i pathA, jboolean srcIsPre)
+{
+    __m128i resA = MUL8_SSE2(pathA, AlphaOf2Pixels_SSE2(src));
+    __m128i dstF = _mm_sub_epi16(_mm_set1_epi16(0xff), resA);
+    __m128i res;
+    if (srcIsPre) {
+        /* srcF = pathA; pixels with resA == 0 are left untouched */
+        __m128i keep = _mm_cmpeq_epi16(resA, _mm_setzero_si128());
+        res = _mm_add_epi16(MUL8_SSE2(dstF, dst), MUL8_SSE2(pathA, src));
+        res = _mm_or_si128(_mm_and_si128(keep, dst),
+                           _mm_andnot_si128(keep, res));
+    } else {
+        /* srcF = resA; the alpha lanes get resA + dstF * dstA */
+        src = _mm_or_si128(src, _mm_set_epi16(0xff, 0, 0, 0, 0xff, 0, 0, 0));
+        res = _mm_add_epi16(MUL8_SSE2(dstF, dst), MUL8_SSE2(resA, src));
+    }
+    return res;
+}
+
+static __m128i SrcOver4Pixels_SSE2(__m128i src, __m128i dst,
+                                   __m128i pathA, jboolean srcIsPre)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i pathLo = _mm_unpacklo_epi32(pathA, pathA);
+    __m128i pathHi = _mm_unpackhi_epi32(pathA, pathA);
+    __m128i lo = SrcOver2Pixels_SSE2(_mm_unpacklo_epi8(src, zero),
+                                     _mm_unpacklo_epi8(dst, zero),
+                                     pathLo, srcIsPre);
+    __m128i hi = SrcOver2Pixels_SSE2(_mm_unpackhi_epi8(src, zero),
+                                     _mm_unpackhi_epi8(dst, zero),
+                                     pathHi, srcIsPre);
+    return _mm_packus_epi16(lo, hi);
+}
+
+/*
+ * Returns the coverage of up to four pixels, each repeated in two 16-bit
+ * lanes, as expected by SrcOver4Pixels_SSE2.
+ */
+static __m128i PathAlpha4Pixels_SSE2(jubyte *pMask, jint n,
+                                     __m128i extraA)
+{
+    jint m = 0;
+    __m128i pathA;
+    memcpy(&m, pMask, n);
+    pathA = _mm_unpacklo_epi8(_mm_cvtsi32_si128(m), _mm_setzero_si128());
+    pathA = MUL8_SSE2(pathA, extraA);
+    return _mm_unpacklo_epi16(pathA, pathA);
+}
+
+static void SrcOverMaskBlitToIntArgbPre_SSE2(void *dstBase, void *srcBase,
+                                             jubyte *pMask, jint maskOff,
+                                             jint maskScan,
+                                             jint width, jint height,
+                                             SurfaceDataRasInfo *pDstInfo,
+                                             SurfaceDataRasInfo *pSrcInfo,
+                                             CompositeInfo *pCompInfo,
+                                             jboolean srcIsPre)
+{
+    jint extraA = (jint)(pCompInfo->details.extraAlpha * 255.0 + 0.5);
+    jint srcScan = pSrcInfo->scanStride;
+    jint dstScan = pDstInfo->scanStride;
+    jint *pSrc = (jint *) srcBase;
+    jint *pDst = (jint *) dstBase;
+    __m128i extraAVec = _mm_set1_epi16((short) extraA);
+    __m128i pathA = _mm_set1_epi16((short) extraA);
+
+    if (pMask) {
+        pMask += maskOff;
+    }
+    do {
+        jint x = 0;
+        for (; x + 4 <= width; x += 4) {
+            __m128i src = _mm_loadu_si128((__m128i *) (pSrc + x));
+            __m128i dst = _mm_loadu_si128((__m128i *) (pDst + x));
+            if (pMask) {
+                pathA = PathAlpha4Pixels_SSE2(pMask + x, 4, extraAVec);
+            }
+            _mm_storeu_si128((__m128i *) (pDst + x),
+                             SrcOver4Pixels_SSE2(src, dst, pathA, srcIsPre));
+        }
+        for (; x < width; x++) {
+            __m128i src = _mm_cvtsi32_si128(pSrc[x]);
+            __m128i dst = _mm_cvtsi32_si128(pDst[x]);
+            if (pMask) {
+                pathA = PathAlpha4Pixels_SSE2(pMask + x, 1, extraAVec);
+            }
+            pDst[x] = _mm_cvtsi128_si32(SrcOver4Pixels_SSE2(src, dst, pathA,
+                                                            srcIsPre));
+        }
+        pSrc = PtrAddBytes(pSrc, srcScan);
+        pDst = PtrAddBytes(pDst, dstScan);
+        if (pMask) {
+            pMask = PtrAddBytes(pMask, maskScan);
+        }
+    } while (--height > 0);
+}
+
+void NAME_SRCOVER_MASKBLIT(IntArgb, IntArgbPre)
+    (void *dstBase, void *srcBase,
+     jubyte *pMask, jint maskOff, jint maskScan,
+     jint width, jint height,
+     SurfaceDataRasInfo *pDstInfo,
+     SurfaceDataRasInfo *pSrcInfo,
+     NativePrimitive *pPrim,
+     CompositeInfo *pCompInfo)
+{
+    SrcOverMaskBlitToIntArgbPre_SSE2(dstBase, srcBase, pMask, maskOff,
+                                     maskScan, width, height,
+                                     pDstInfo, pSrcInfo, pCompInfo,
+                                     JNI_FALSE);
+}
+
+void NAME_SRCOVER_MASKBLIT(IntArgbPre, IntArgbPre)
+    (void *dstBase, void *srcBase,
+     jubyte *pMask, jint maskOff, jint maskScan,
+     jint width, jint height,
+     SurfaceDataRasInfo *pDstInfo,
+     SurfaceDataRasInfo *pSrcInfo,
+     NativePrimitive *pPrim,
+     CompositeInfo *pCompInfo)
+{
+    SrcOverMaskBlitToIntArgbPre_SSE2(dstBase, srcBase, pMask, maskOff,
+                                     maskScan, width, height,
+                                     pDstInfo, pSrcInfo, pCompInfo,
+                                     JNI_TRUE);
+}
+
+#else /* !INTARGBPRE_SRCOVER_SSE2 */
+
+DEFINE_SRCOVER_MASKBLIT(IntArgb, IntArgbPre, 4ByteArgb)
 
 DEFINE_SRCOVER_MASKBLIT(IntArgbPre, IntArgbPre, 4ByteArgb)
 
+#endif /* INTARGBPRE_SRCOVER_SSE2 */
+
+DEFINE_ALPHA_MASKBLIT(IntArgb, IntArgbPre, 4ByteArgb)
+
 DEFINE_ALPHA_MASKBLIT(IntArgbPre, IntArgbPre, 4ByteArgb)
 
 DEFINE_ALPHA_MASKBLIT(IntRgb, IntArgbPre, 4ByteArgb)
@@ -46,6 +46,10 @@ typedef struct symtab {
   size_t num_symbols;
   struct elf_symbol *symbols;
   struct hsearch_data *hash_table;
+  // address-to-symbol index, built on first nearest_symbol() call
+  struct elf_symbol **by_offset;
+  size_t num_by_offset;
+  uintptr_t max_size;
 } symtab_t;
 
 
@@ -519,6 +523,7 @@ void destroy_symtab(struct symtab* symtab) {
   if (!symtab) return;
   if (symtab->strs) free(symtab->strs);
   if (symtab->symbols) free(symtab->symbols);
+  if (symtab->by_offset) free(symtab->by_offset);
   if (symtab->hash_table) {
      hdestroy_r(symtab->hash_table);
      free(symtab->hash_table);
@@ -550,17 +555,72 @@ uintptr_t search_symbol(struct symtab* symtab, uintptr_t base,
   return (uintptr_t) NULL;
 }
 
+static int compare_by_offset(const void *a, const void *b) {
+  const struct elf_symbol *sa = *(const struct elf_symbol * const *)a;
+  const struct elf_symbol *sb = *(const struct elf_symbol * const *)b;
+  if (sa->offset != sb->offset) {
+    return sa->offset < sb->offset ? -1 : 1;
+  }
+  // keep symbol table order for aliases
+  return sa < sb ? -1 : (sa > sb ? 1 : 0);
+}
+
+// Sort the named, non-empty symbols by offset so that nearest_symbol()
+// can binary search instead of scanning the whole table.
+static bool build_offset_index(struct symtab* symtab) {
+  size_t n, count = 0;
+  symtab->by_offset = (struct elf_symbol **)calloc(symtab->num_symbols > 0 ? symtab->num_symbols : 1,
+                                                   sizeof(struct elf_symbol *));
+  if (symtab->by_offset == NULL) {
+    return false;
+  }
+  for (n = 0; n < symtab->num_symbols; n++) {
+    struct elf_symbol* sym = &(symtab->symbols[n]);
+    if (sym->name != NULL && sym->size > 0) {
+      symtab->by_offset[count++] = sym;
+      if (sym->size > symtab->max_size) {
+        symtab->max_size = sym->size;
+      }
+    }
+  }
+  qsort(symtab->by_offset, count, sizeof(struct elf_symbol *), compare_by_offset);
+  symtab->num_by_offset = count;
+  return true;
+}
+
 const char* nearest_symbol(struct symtab* symtab, uintptr_t offset,
                            uintptr_t* poffset) {
-  int n = 0;
+  struct elf_symbol* found = NULL;
+  size_t lo = 0, hi;
   if (!symtab) return NULL;
-  for (; n < symtab->num_symbols; n++) {
-     struct elf_symbol* sym = &(symtab->symbols[n]);
-     if (sym->name != NULL &&
-         offset >= sym->offset && offset < sym->offset + sym->size) {
-        if (poffset) *poffset = (offset - sym->offset);
-        return sym->name;
-     }
+  if (symtab->by_offset == NULL && !build_offset_index(symtab)) {
+    return NULL;
   }
-  return NULL;
+
+  // find the first symbol that starts after offset
+  hi = symtab->num_by_offset;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (symtab->by_offset[mid]->offset <= offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // Walk back over the symbols that could still contain offset. Like the
+  // linear scan, prefer the one that comes first in the symbol table.
+  while (lo > 0) {
+    struct elf_symbol* sym = symtab->by_offset[--lo];
+    if (offset - sym->offset >= symtab->max_size) {
+      break;
+    }
+    if (offset < sym->offset + sym->size && (found == NULL || sym < found)) {
+      found = sym;
+    }
+  }
+
+  if (found == NULL) return NULL;
+  if (poffset) *poffset = (offset - found->offset);
+  return found->name;
 }
@@ -689,6 +689,26 @@ eventFilter_predictFiltering(HandlerNode *node, jclass clazz, char *classname)
     return willBeFiltered;
 }
 
+/*
+ * Returns true if the node has a ClassMatch or ClassExclude filter,
+ * i.e. if filtering events for it needs the class name.
+ */
+jboolean
+eventFilter_hasClassPatternFilter(HandlerNode *node)
+{
+    Filter *filter = FILTERS_ARRAY(node);
+    int i;
+
+    for (i = 0; i < FILTER_COUNT(node); ++i, ++filter) {
+        switch (filter->modifier) {
+            case JDWP_REQUEST_MODIFIER(ClassMatch):
+            case JDWP_REQUEST_MODIFIER(ClassExclude):
+                return JNI_TRUE;
+        }
+    }
+    return JNI_FALSE;
+}
+
 /**
  * Determine if the given breakpoint node is in the specified class.
  */
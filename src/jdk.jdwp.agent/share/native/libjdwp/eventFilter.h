@@ -74,6 +74,7 @@ jvmtiError eventFilter_setPlatformThreadsOnlyFilter(HandlerNode *node, jint inde
 /***** misc *****/
 
 jboolean eventFilter_predictFiltering(HandlerNode *node, jclass clazz, char *classname);
+jboolean eventFilter_hasClassPatternFilter(HandlerNode *node);
 jboolean isBreakpointSet(jclass clazz, jmethodID method, jlocation location);
 
 /***** debugging *****/
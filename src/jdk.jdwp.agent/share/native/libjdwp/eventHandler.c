@@ -550,8 +550,16 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
         HandlerNode *node;
         char        *classname;
 
+        /* Only look up the class name if some filter needs it. */
+        classname = NULL;
+        for (node = getHandlerChain(ei)->first; node != NULL; node = NEXT(node)) {
+            if (eventFilter_hasClassPatternFilter(node)) {
+                classname = getClassname(evinfo->clazz);
+                break;
+            }
+        }
+
         node = getHandlerChain(ei)->first;
-        classname = getClassname(evinfo->clazz);
 
         /* Filter the event over each handler node. */
         while (node != NULL) {
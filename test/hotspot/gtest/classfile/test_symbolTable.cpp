@@ -96,6 +96,14 @@ TEST_VM(SymbolTable, temp_new_symbol) {
     bigsym->decrement_refcount();
   }
   ASSERT_EQ(bigsym->refcount(), PERM_REFCOUNT) << "should be sticky";
+
+  // Test that a hot symbol is made permanent
+  Symbol* hotsym = SymbolTable::new_symbol("hotsym");
+  while (hotsym->refcount() < HOT_REFCOUNT - 1) {
+    hotsym->increment_refcount();
+  }
+  hotsym->increment_refcount();
+  ASSERT_EQ(hotsym->refcount(), PERM_REFCOUNT) << "should be permanent";
 }
 
 // TODO: Make two threads one decrementing the refcount and the other trying to increment.
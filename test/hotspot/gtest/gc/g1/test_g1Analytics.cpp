@@ -33,3 +33,26 @@ TEST_VM(G1Analytics, is_initialized) {
   ASSERT_EQ(a.long_term_pause_time_ratio(), 0.0);
   ASSERT_EQ(a.short_term_pause_time_ratio(), 0.0);
 }
+
+TEST_VM(G1Analytics, trend_seq_follows_trend) {
+  G1TrendSeq seq(0.5, 0.5);
+  ASSERT_EQ(seq.num(), 0u);
+
+  seq.add(10.0);
+  ASSERT_EQ(seq.level(), 10.0);
+  ASSERT_EQ(seq.forecast(), 10.0);
+
+  // A steadily increasing sequence must forecast a higher value than the
+  // last sample.
+  for (int i = 2; i <= 20; i++) {
+    seq.add(10.0 * i);
+  }
+  ASSERT_GT(seq.trend(), 0.0);
+  ASSERT_GT(seq.forecast(), 200.0);
+
+  // Forecasts are never negative.
+  for (int i = 0; i < 20; i++) {
+    seq.add(0.0);
+  }
+  ASSERT_GE(seq.forecast(10), 0.0);
+}
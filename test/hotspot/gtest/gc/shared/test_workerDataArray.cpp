@@ -63,7 +63,7 @@ class WorkerDataArrayTest : public ::testing::Test {
   // returns expected summary for array without uninitialized elements
   // used it because string representation of double depends on locale
   static const char* format_summary(
-    T min, double avg, T max, T diff, T sum, size_t workers);
+    T min, double avg, T max, T diff, T sum, size_t workers, uint max_worker);
 
   const char* title;
   WorkerDataArray<T> array;
@@ -86,27 +86,27 @@ class WorkerDataArrayTest : public ::testing::Test {
 
 template<>
 const char* WorkerDataArrayTest<size_t>::format_summary(
-  size_t min, double avg, size_t max, size_t diff, size_t sum, size_t workers) {
+  size_t min, double avg, size_t max, size_t diff, size_t sum, size_t workers, uint max_worker) {
 
   stringStream out;
   out.print(" Min: " SIZE_FORMAT
             ", Avg: %4.1lf, Max: " SIZE_FORMAT
             ", Diff: " SIZE_FORMAT ", Sum: " SIZE_FORMAT
-            ", Workers: " SIZE_FORMAT "\n",
-            min, avg, max, diff, sum, workers);
+            ", Workers: " SIZE_FORMAT ", Max Worker: %u\n",
+            min, avg, max, diff, sum, workers, max_worker);
   return out.as_string();
 }
 
 template<>
 const char* WorkerDataArrayTest<double>::format_summary(
-  double min, double avg, double max, double diff, double sum, size_t workers) {
+  double min, double avg, double max, double diff, double sum, size_t workers, uint max_worker) {
 
   stringStream out;
   out.print(" Min: %4.2lf"
             ", Avg: %4.2lf, Max: %4.2lf"
             ", Diff: %4.2lf, Sum: %4.2lf"
-            ", Workers: " SIZE_FORMAT "\n",
-            min, avg, max, diff, sum, workers);
+            ", Workers: " SIZE_FORMAT ", Max Worker: %u\n",
+            min, avg, max, diff, sum, workers, max_worker);
   return out.as_string();
 }
 
@@ -124,7 +124,7 @@ class BasicWorkerDataArrayTest : public WorkerDataArrayTest<size_t> {
 
  private:
   virtual const char* expected_summary() {
-    return format_summary(3, 5.0, 7, 4, 15, 3);
+    return format_summary(3, 5.0, 7, 4, 15, 3, 2);
   }
 
   virtual const char* expected_details() {
@@ -174,7 +174,7 @@ class AddWorkerDataArrayTest : public WorkerDataArrayTest<size_t> {
 
  private:
   virtual const char* expected_summary() {
-    return format_summary(4, 6.0, 8, 4, 18, 3);
+    return format_summary(4, 6.0, 8, 4, 18, 3, 2);
   }
 
   virtual const char* expected_details() {
@@ -210,7 +210,7 @@ class UninitializedElementWorkerDataArrayTest : public WorkerDataArrayTest<size_
 
  private:
   virtual const char* expected_summary() {
-    return format_summary(5, 6.0, 7, 2, 12, 2);
+    return format_summary(5, 6.0, 7, 2, 12, 2, 2);
   }
 
   virtual const char* expected_details() {
@@ -278,7 +278,7 @@ class UninitializedDoubleElementWorkerDataArrayTest : public WorkerDataArrayTest
 
  private:
   virtual const char* expected_summary() {
-    return format_summary(5.10, 6.15, 7.20, 2.10, 12.30, 2);
+    return format_summary(5.10, 6.15, 7.20, 2.10, 12.30, 2, 2);
   }
 
   virtual const char* expected_details() {
@@ -158,3 +158,12 @@ TEST_VM_F(LogTest, disabled_logtargethandle) {
 
   EXPECT_FALSE(file_contains_substring(TestLogFileName, "3 workers"));
 }
+
+TEST_VM_F(LogTest, json_format) {
+  set_log_config(TestLogFileName, "gc=info", "level,tags", "format=json");
+
+  log_info(gc)("a \"quoted\" \\ line\twith tab");
+
+  EXPECT_TRUE(file_contains_substring(TestLogFileName,
+      "{\"level\":\"info\",\"tags\":\"gc\",\"msg\":\"a \\\"quoted\\\" \\\\ line\\twith tab\"}"));
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef GTEST_MICROBENCHMARK_HPP
+#define GTEST_MICROBENCHMARK_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "unittest.hpp"
+
+// A minimal timing harness for benchmarking VM-internal data structures from
+// gtests. Benchmarks are registered as disabled tests (test suite prefixed
+// with DISABLED_) so they never run as part of normal testing, and are run
+// explicitly with e.g.
+//
+//   gtestLauncher -jdk <jdk> --gtest_also_run_disabled_tests \
+//     --gtest_filter='DISABLED_Benchmark*' --gtest_output=json:bench.json
+//
+// Each measurement prints a summary line and records the median and minimum
+// ns/op as test properties, which gtest includes in its XML/JSON reports.
+class MicroBenchmark : public StackObj {
+  static const int MaxIterations = 64;
+
+  const char* const _name;
+  const int _warmup;
+  const int _iterations;
+  volatile uintx _sink;
+
+  static void sort(jlong* a, int n) {
+    for (int i = 1; i < n; i++) {
+      jlong v = a[i];
+      int j = i - 1;
+      for (; j >= 0 && a[j] > v; j--) {
+        a[j + 1] = a[j];
+      }
+      a[j + 1] = v;
+    }
+  }
+
+  void record(const char* key, double value) {
+    char buf[256];
+    os::snprintf_checked(buf, sizeof(buf), "%s_%s", _name, key);
+    char val[64];
+    os::snprintf_checked(val, sizeof(val), "%.3f", value);
+    ::testing::Test::RecordProperty(buf, val);
+  }
+
+public:
+  MicroBenchmark(const char* name, int warmup = 3, int iterations = 10) :
+    _name(name), _warmup(warmup), _iterations(MIN2(iterations, (int)MaxIterations)), _sink(0) {
+    assert(_iterations > 0, "must measure at least once");
+  }
+
+  // Run fn, which performs ops operations per call and returns a value
+  // that is consumed to keep the work from being optimized away.
+  template <typename Fn>
+  void run(size_t ops, Fn fn) {
+    for (int i = 0; i < _warmup; i++) {
+      _sink += fn();
+    }
+
+    jlong times[MaxIterations];
+    for (int i = 0; i < _iterations; i++) {
+      jlong start = os::javaTimeNanos();
+      _sink += fn();
+      times[i] = os::javaTimeNanos() - start;
+    }
+    sort(times, _iterations);
+
+    const double median = (double)times[_iterations / 2] / (double)ops;
+    const double min = (double)times[0] / (double)ops;
+    tty->print_cr("%s: median %.3f ns/op, min %.3f ns/op (%d iterations of " SIZE_FORMAT " ops)",
+                  _name, median, min, _iterations, ops);
+    record("median_ns_per_op", median);
+    record("min_ns_per_op", min);
+  }
+};
+
+#endif // GTEST_MICROBENCHMARK_HPP
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/resourceHash.hpp"
+#include "microBenchmark.hpp"
+#include "unittest.hpp"
+
+// Baseline benchmarks for frequently used utility data structures. These are
+// disabled by default; see microBenchmark.hpp for how to run them.
+
+TEST_VM(DISABLED_Benchmark, bitmap_find_first_set_bit) {
+  const BitMap::idx_t size = 1024 * 1024;
+  const BitMap::idx_t stride = 997;
+  CHeapBitMap map(size, mtTest);
+  for (BitMap::idx_t i = 0; i < size; i += stride) {
+    map.set_bit(i);
+  }
+  const size_t ops = (size + stride - 1) / stride;
+
+  MicroBenchmark bench("bitmap_find_first_set_bit");
+  bench.run(ops, [&]() {
+    uintx found = 0;
+    for (BitMap::idx_t i = map.find_first_set_bit(0); i < size; i = map.find_first_set_bit(i + 1)) {
+      found++;
+    }
+    return found;
+  });
+}
+
+TEST_VM(DISABLED_Benchmark, growableArray_append) {
+  const int ops = 1024 * 1024;
+  GrowableArrayCHeap<int, mtTest> array;
+
+  MicroBenchmark bench("growableArray_append");
+  bench.run(ops, [&]() {
+    array.clear();
+    for (int i = 0; i < ops; i++) {
+      array.append(i);
+    }
+    return (uintx)array.length();
+  });
+}
+
+TEST_VM(DISABLED_Benchmark, resourceHashtable_get) {
+  const uintx entries = 4 * 1024;
+  ResourceHashtable<uintx, uintx, 1031, AnyObj::C_HEAP, mtTest> table;
+  for (uintx i = 0; i < entries; i++) {
+    table.put(i, i);
+  }
+
+  MicroBenchmark bench("resourceHashtable_get");
+  bench.run(entries, [&]() {
+    uintx sum = 0;
+    for (uintx i = 0; i < entries; i++) {
+      sum += *table.get(i);
+    }
+    return sum;
+  });
+}
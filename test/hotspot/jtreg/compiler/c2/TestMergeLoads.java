@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.c2;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Utils;
+import java.util.Random;
+
+/*
+ * @test
+ * @summary Test merging of adjacent byte array loads into a wider load.
+ * @library /test/lib /
+ * @run driver compiler.c2.TestMergeLoads
+ */
+
+public class TestMergeLoads {
+    static final int RANGE = 64;
+    static final Random RANDOM = Utils.getRandomInstance();
+
+    byte[] a = new byte[RANGE];
+    byte[] c = new byte[RANGE];
+
+    public static void main(String[] args) {
+        TestFramework framework = new TestFramework(TestMergeLoads.class);
+        framework.addFlags("-XX:+UnlockDiagnosticVMOptions");
+        framework.addScenarios(new Scenario(0, "-XX:+MergeLoads"),
+                               new Scenario(1, "-XX:-MergeLoads"));
+        framework.start();
+    }
+
+    // ------------------------------------------------------------------
+    // Positive cases
+    // ------------------------------------------------------------------
+
+    @Test
+    @IR(counts = {IRNode.LOAD_I, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB},
+        applyIfAnd = {"MergeLoads", "true", "UseUnalignedAccesses", "true"},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int intAscending(byte[] a, int i) {
+        return (a[i + 0] & 0xff)       |
+               (a[i + 1] & 0xff) << 8  |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 3]       ) << 24;
+    }
+
+    @DontCompile
+    static int intAscendingRef(byte[] a, int i) {
+        int r = 0;
+        for (int k = 3; k >= 0; k--) {
+            r = (r << 8) | (a[i + k] & 0xff);
+        }
+        return r;
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_I, "1", IRNode.REVERSE_BYTES_I, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB},
+        applyIfAnd = {"MergeLoads", "true", "UseUnalignedAccesses", "true"},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int intDescending(byte[] a, int i) {
+        return (a[i + 3] & 0xff)       |
+               (a[i + 2] & 0xff) << 8  |
+               (a[i + 1] & 0xff) << 16 |
+               (a[i + 0]       ) << 24;
+    }
+
+    @DontCompile
+    static int intDescendingRef(byte[] a, int i) {
+        int r = 0;
+        for (int k = 0; k < 4; k++) {
+            r = (r << 8) | (a[i + k] & 0xff);
+        }
+        return r;
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_L, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB},
+        applyIfAnd = {"MergeLoads", "true", "UseUnalignedAccesses", "true"},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static long longAscending(byte[] a, int i) {
+        return (a[i + 0] & 0xffL)       |
+               (a[i + 1] & 0xffL) << 8  |
+               (a[i + 2] & 0xffL) << 16 |
+               (a[i + 3] & 0xffL) << 24 |
+               (a[i + 4] & 0xffL) << 32 |
+               (a[i + 5] & 0xffL) << 40 |
+               (a[i + 6] & 0xffL) << 48 |
+               ((long)a[i + 7])   << 56;
+    }
+
+    @DontCompile
+    static long longAscendingRef(byte[] a, int i) {
+        long r = 0;
+        for (int k = 7; k >= 0; k--) {
+            r = (r << 8) | (a[i + k] & 0xffL);
+        }
+        return r;
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_L, "1", IRNode.REVERSE_BYTES_L, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB},
+        applyIfAnd = {"MergeLoads", "true", "UseUnalignedAccesses", "true"},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static long longDescending(byte[] a, int i) {
+        return (a[i + 7] & 0xffL)       |
+               (a[i + 6] & 0xffL) << 8  |
+               (a[i + 5] & 0xffL) << 16 |
+               (a[i + 4] & 0xffL) << 24 |
+               (a[i + 3] & 0xffL) << 32 |
+               (a[i + 2] & 0xffL) << 40 |
+               (a[i + 1] & 0xffL) << 48 |
+               ((long)a[i + 0])   << 56;
+    }
+
+    @DontCompile
+    static long longDescendingRef(byte[] a, int i) {
+        long r = 0;
+        for (int k = 0; k < 8; k++) {
+            r = (r << 8) | (a[i + k] & 0xffL);
+        }
+        return r;
+    }
+
+    // ------------------------------------------------------------------
+    // Negative cases
+    // ------------------------------------------------------------------
+
+    // The low byte is sign extended and smears into the upper bits.
+    @Test
+    @IR(failOn = {IRNode.LOAD_I},
+        applyIf = {"UseUnalignedAccesses", "true"})
+    static int intSignedLowByte(byte[] a, int i) {
+        return (a[i + 0]       )       |
+               (a[i + 1] & 0xff) << 8  |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 3]       ) << 24;
+    }
+
+    @DontCompile
+    static int intSignedLowByteRef(byte[] a, int i) {
+        return intAscendingRef(a, i) | a[i + 0];
+    }
+
+    @Test
+    @IR(failOn = {IRNode.LOAD_L},
+        applyIf = {"UseUnalignedAccesses", "true"})
+    static long longSignedLowByte(byte[] a, int i) {
+        return ((long)a[i + 0])         |
+               (a[i + 1] & 0xffL) << 8  |
+               (a[i + 2] & 0xffL) << 16 |
+               (a[i + 3] & 0xffL) << 24 |
+               (a[i + 4] & 0xffL) << 32 |
+               (a[i + 5] & 0xffL) << 40 |
+               (a[i + 6] & 0xffL) << 48 |
+               ((long)a[i + 7])   << 56;
+    }
+
+    @DontCompile
+    static long longSignedLowByteRef(byte[] a, int i) {
+        return longAscendingRef(a, i) | (long)a[i + 0];
+    }
+
+    // A store to another byte array gives the later loads a different memory state.
+    @Test
+    @IR(failOn = {IRNode.LOAD_I},
+        applyIf = {"UseUnalignedAccesses", "true"})
+    static int intDifferentMemory(byte[] a, byte[] c, int i) {
+        int lo = (a[i + 0] & 0xff) |
+                 (a[i + 1] & 0xff) << 8;
+        c[i] = 42;
+        int hi = (a[i + 2] & 0xff) << 16 |
+                 (a[i + 3]       ) << 24;
+        return lo | hi;
+    }
+
+    @DontCompile
+    static int intDifferentMemoryRef(byte[] a, byte[] c, int i) {
+        int lo = (a[i + 0] & 0xff) |
+                 (a[i + 1] & 0xff) << 8;
+        c[i] = 42;
+        int hi = (a[i + 2] & 0xff) << 16 |
+                 (a[i + 3]       ) << 24;
+        return lo | hi;
+    }
+
+    // A store into the loaded range between the loads.
+    @Test
+    @IR(failOn = {IRNode.LOAD_I},
+        applyIf = {"UseUnalignedAccesses", "true"})
+    static int intInterleavedStore(byte[] a, int i, byte v) {
+        int lo = (a[i + 0] & 0xff) |
+                 (a[i + 1] & 0xff) << 8;
+        a[i + 2] = v;
+        int hi = (a[i + 2] & 0xff) << 16 |
+                 (a[i + 3]       ) << 24;
+        return lo | hi;
+    }
+
+    @DontCompile
+    static int intInterleavedStoreRef(byte[] a, int i, byte v) {
+        int lo = (a[i + 0] & 0xff) |
+                 (a[i + 1] & 0xff) << 8;
+        a[i + 2] = v;
+        int hi = (a[i + 2] & 0xff) << 16 |
+                 (a[i + 3]       ) << 24;
+        return lo | hi;
+    }
+
+    // The bytes are not adjacent.
+    @Test
+    @IR(failOn = {IRNode.LOAD_I},
+        applyIf = {"UseUnalignedAccesses", "true"})
+    static int intNonAdjacent(byte[] a, int i) {
+        return (a[i + 0] & 0xff)       |
+               (a[i + 1] & 0xff) << 8  |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 4]       ) << 24;
+    }
+
+    @DontCompile
+    static int intNonAdjacentRef(byte[] a, int i) {
+        return (a[i + 0] & 0xff)       |
+               (a[i + 1] & 0xff) << 8  |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 4]       ) << 24;
+    }
+
+    // ------------------------------------------------------------------
+
+    @Run(test = {"intAscending", "intDescending", "longAscending", "longDescending",
+                 "intSignedLowByte", "longSignedLowByte", "intDifferentMemory",
+                 "intInterleavedStore", "intNonAdjacent"})
+    public void runTests() {
+        RANDOM.nextBytes(a);
+        int i = RANDOM.nextInt(RANGE - 8);
+        byte v = (byte)RANDOM.nextInt();
+
+        check("intAscending", intAscending(a, i), intAscendingRef(a, i));
+        check("intDescending", intDescending(a, i), intDescendingRef(a, i));
+        check("longAscending", longAscending(a, i), longAscendingRef(a, i));
+        check("longDescending", longDescending(a, i), longDescendingRef(a, i));
+        check("intSignedLowByte", intSignedLowByte(a, i), intSignedLowByteRef(a, i));
+        check("longSignedLowByte", longSignedLowByte(a, i), longSignedLowByteRef(a, i));
+        check("intNonAdjacent", intNonAdjacent(a, i), intNonAdjacentRef(a, i));
+
+        byte[] a2 = a.clone();
+        check("intDifferentMemory", intDifferentMemory(a, c, i), intDifferentMemoryRef(a2, c, i));
+        check("intInterleavedStore", intInterleavedStore(a, i, v), intInterleavedStoreRef(a2, i, v));
+    }
+
+    static void check(String name, long actual, long expected) {
+        if (actual != expected) {
+            throw new RuntimeException(name + ": expected " + expected + " but got " + actual);
+        }
+    }
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Compare the x86_64 SHA3 intrinsic against a pure Java Keccak.
+ * @key randomness
+ * @requires os.arch == "amd64" | os.arch == "x86_64"
+ * @requires vm.cpu.features ~= ".*avx512f.*"
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @run main/othervm -Xbatch -XX:+UseSHA3Intrinsics
+ *      compiler.intrinsics.sha.TestSHA3Intrinsic
+ * @run main/othervm -Xbatch -XX:+UseSHA3Intrinsics -XX:-TieredCompilation
+ *      compiler.intrinsics.sha.TestSHA3Intrinsic
+ */
+
+package compiler.intrinsics.sha;
+
+import java.security.MessageDigest;
+import java.util.Arrays;
+import java.util.HexFormat;
+import java.util.Random;
+
+import jdk.test.lib.Utils;
+
+public class TestSHA3Intrinsic {
+    static final Random RANDOM = Utils.getRandomInstance();
+    static final int ITERATIONS = 20_000;
+
+    // Digest length in bytes for SHA3-224/256/384/512. The rate is
+    // 200 - 2 * length, i.e. 144, 136, 104 and 72 bytes.
+    static final int[] DIGEST_LENGTHS = { 28, 32, 48, 64 };
+
+    public static void main(String[] args) throws Exception {
+        for (int len : DIGEST_LENGTHS) {
+            test(len);
+        }
+    }
+
+    static void test(int digestLength) throws Exception {
+        String alg = "SHA3-" + (digestLength * 8);
+        int rate = 200 - 2 * digestLength;
+        MessageDigest md = MessageDigest.getInstance(alg);
+
+        // Message lengths around the block boundaries; anything of two
+        // or more blocks passed in a single update() goes through
+        // implCompressMB.
+        int[] sizes = { 0, 1, rate - 1, rate, rate + 1, 2 * rate - 1,
+                        2 * rate, 2 * rate + 1, 5 * rate + 7, 4096 };
+        byte[][] messages = new byte[sizes.length][];
+        byte[][] expected = new byte[sizes.length][];
+        for (int i = 0; i < sizes.length; i++) {
+            messages[i] = new byte[sizes[i]];
+            RANDOM.nextBytes(messages[i]);
+            expected[i] = keccak(messages[i], digestLength);
+        }
+
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            int i = iter % sizes.length;
+            byte[] msg = messages[i];
+
+            // multi-block path
+            md.update(msg);
+            check(alg, "update(byte[])", msg.length, md.digest(), expected[i]);
+
+            // single-block path: feed the message in odd sized pieces
+            int chunk = 1 + (iter % (rate + 3));
+            for (int off = 0; off < msg.length; off += chunk) {
+                md.update(msg, off, Math.min(chunk, msg.length - off));
+            }
+            check(alg, "update(chunk=" + chunk + ")", msg.length, md.digest(), expected[i]);
+        }
+    }
+
+    static void check(String alg, String how, int size, byte[] actual, byte[] expected) {
+        if (!Arrays.equals(actual, expected)) {
+            HexFormat hex = HexFormat.of();
+            throw new RuntimeException(alg + " " + how + " of " + size + " bytes: expected " +
+                                       hex.formatHex(expected) + " but got " + hex.formatHex(actual));
+        }
+    }
+
+    // ------------------------------------------------------------------
+    // Reference Keccak-f[1600] with SHA3 padding, independent of the JDK
+    // provider and therefore of the intrinsic.
+    // ------------------------------------------------------------------
+
+    static final long[] RC = {
+        0x0000000000000001L, 0x0000000000008082L, 0x800000000000808AL,
+        0x8000000080008000L, 0x000000000000808BL, 0x0000000080000001L,
+        0x8000000080008081L, 0x8000000000008009L, 0x000000000000008AL,
+        0x0000000000000088L, 0x0000000080008009L, 0x000000008000000AL,
+        0x000000008000808BL, 0x800000000000008BL, 0x8000000000008089L,
+        0x8000000000008003L, 0x8000000000008002L, 0x8000000000000080L,
+        0x000000000000800AL, 0x800000008000000AL, 0x8000000080008081L,
+        0x8000000000008080L, 0x0000000080000001L, 0x8000000080008008L
+    };
+
+    // rotation offsets, indexed by x + 5 * y
+    static final int[] RHO = {
+         0,  1, 62, 28, 27,
+        36, 44,  6, 55, 20,
+         3, 10, 43, 25, 39,
+        41, 45, 15, 21,  8,
+        18,  2, 61, 56, 14
+    };
+
+    static byte[] keccak(byte[] msg, int digestLength) {
+        int rate = 200 - 2 * digestLength;
+        int padded = (msg.length / rate + 1) * rate;
+        byte[] buf = Arrays.copyOf(msg, padded);
+        buf[msg.length] ^= 0x06;
+        buf[padded - 1] ^= (byte)0x80;
+
+        long[] a = new long[25];
+        for (int off = 0; off < padded; off += rate) {
+            for (int i = 0; i < rate / 8; i++) {
+                a[i] ^= getLong(buf, off + 8 * i);
+            }
+            permute(a);
+        }
+
+        byte[] out = new byte[digestLength];
+        for (int i = 0; i < digestLength; i++) {
+            out[i] = (byte)(a[i / 8] >>> (8 * (i % 8)));
+        }
+        return out;
+    }
+
+    static long getLong(byte[] b, int off) {
+        long v = 0;
+        for (int k = 7; k >= 0; k--) {
+            v = (v << 8) | (b[off + k] & 0xffL);
+        }
+        return v;
+    }
+
+    static void permute(long[] a) {
+        long[] c = new long[5];
+        long[] b = new long[25];
+        for (int round = 0; round < 24; round++) {
+            // theta
+            for (int x = 0; x < 5; x++) {
+                c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+            }
+            for (int x = 0; x < 5; x++) {
+                long d = c[(x + 4) % 5] ^ Long.rotateLeft(c[(x + 1) % 5], 1);
+                for (int y = 0; y < 25; y += 5) {
+                    a[x + y] ^= d;
+                }
+            }
+            // rho and pi
+            for (int x = 0; x < 5; x++) {
+                for (int y = 0; y < 5; y++) {
+                    b[y + 5 * ((2 * x + 3 * y) % 5)] = Long.rotateLeft(a[x + 5 * y], RHO[x + 5 * y]);
+                }
+            }
+            // chi
+            for (int y = 0; y < 25; y += 5) {
+                for (int x = 0; x < 5; x++) {
+                    a[x + y] = b[x + y] ^ (~b[(x + 1) % 5 + y] & b[(x + 2) % 5 + y]);
+                }
+            }
+            // iota
+            a[0] ^= RC[round];
+        }
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check the aarch64 SVE String.indexOf against a scalar reference
+ *          for LL, UU and UL encodings.
+ * @key randomness
+ * @requires os.arch == "aarch64" & vm.cpu.features ~= ".*sve.*"
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:+UseSVEStringIndexOf
+ *      compiler.intrinsics.string.TestStringIndexOfSVE
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:+UseSVEStringIndexOf
+ *      -XX:MaxVectorSize=16 compiler.intrinsics.string.TestStringIndexOfSVE
+ */
+
+package compiler.intrinsics.string;
+
+import java.util.Random;
+
+import jdk.test.lib.Utils;
+
+public class TestStringIndexOfSVE {
+    static final Random RANDOM = Utils.getRandomInstance();
+    static final int ITERATIONS = 20_000;
+
+    // The alphabet is small so that first/last char candidates are frequent.
+    static final char[] LATIN1 = { 'a', 'b', 'c', '\u00e9' };
+    static final char[] UTF16  = { 'a', 'b', '\u0100', '\u4e2d' };
+
+    public static void main(String[] args) {
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            test(LATIN1, LATIN1, iter); // LL
+            test(UTF16,  UTF16,  iter); // UU
+            test(UTF16,  LATIN1, iter); // UL
+        }
+    }
+
+    static void test(char[] haystackChars, char[] needleChars, int iter) {
+        // Needle lengths around the 16 to 256 byte vector lengths, and
+        // haystacks that end in a partial vector.
+        int needleLen = 1 + RANDOM.nextInt(iter % 4 == 0 ? 160 : 40);
+        int haystackLen = needleLen + 1 + RANDOM.nextInt(300);
+
+        char[] h = random(haystackChars, haystackLen);
+        char[] n = random(needleChars, needleLen);
+        if (needleChars == UTF16) {
+            n[RANDOM.nextInt(needleLen)] = '\u4e2d';
+        }
+
+        // Plant the needle, often at the very end of the haystack.
+        switch (iter % 3) {
+            case 0 -> System.arraycopy(n, 0, h, haystackLen - needleLen, needleLen);
+            case 1 -> System.arraycopy(n, 0, h, 1 + RANDOM.nextInt(haystackLen - needleLen), needleLen);
+            default -> { }
+        }
+        // Make sure the haystack is UTF16 when requested; index 0 is never
+        // covered by the planted needle.
+        if (haystackChars == UTF16) {
+            h[0] = '\u4e2d';
+        }
+
+        String haystack = new String(h);
+        String needle = new String(n);
+        int from = RANDOM.nextInt(4) == 0 ? RANDOM.nextInt(haystackLen) : 0;
+
+        int expected = indexOfRef(h, n, from);
+        int actual = haystack.indexOf(needle, from);
+        if (actual != expected) {
+            throw new RuntimeException("indexOf(\"" + needle + "\", " + from + ") in \"" + haystack +
+                                       "\": expected " + expected + " but got " + actual);
+        }
+    }
+
+    static char[] random(char[] alphabet, int len) {
+        char[] c = new char[len];
+        for (int i = 0; i < len; i++) {
+            c[i] = alphabet[RANDOM.nextInt(alphabet.length)];
+        }
+        return c;
+    }
+
+    static int indexOfRef(char[] h, char[] n, int from) {
+        outer:
+        for (int i = from; i <= h.length - n.length; i++) {
+            for (int j = 0; j < n.length; j++) {
+                if (h[i + j] != n[j]) {
+                    continue outer;
+                }
+            }
+            return i;
+        }
+        return -1;
+    }
+}
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import jdk.internal.misc.Unsafe;
+import jdk.test.lib.Utils;
+import java.lang.foreign.Arena;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.ValueLayout;
+import java.util.Arrays;
+import java.util.Random;
+
+/*
+ * @test
+ * @summary VPointer must accept an iv scaled by a long constant that is not a
+ *          power of 2, and must still reject such scales when the scale or
+ *          offset overflows an int or when the scaled expression has an invariant.
+ * @key randomness
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestLongScaledIV
+ */
+
+public class TestLongScaledIV {
+    static final Unsafe UNSAFE = Unsafe.getUnsafe();
+    static final Random RANDOM = Utils.getRandomInstance();
+
+    static final long BASE_I = UNSAFE.arrayBaseOffset(int[].class);
+    static final long BASE_B = UNSAFE.arrayBaseOffset(byte[].class);
+
+    // Number of structs, and the largest invariant used to index them.
+    static final int N = 1000;
+    static final int MAX_INV = 16;
+
+    // Used to push the scaled offset past the int range.
+    static final int BIG = 1 << 27;
+    static final long BIG_SCALE = (1L << 32) + 12;
+
+    int[] iSrc = new int[7 * (N + MAX_INV)];
+    int[] iDst = new int[7 * (N + MAX_INV)];
+    int[] iRef = new int[7 * (N + MAX_INV)];
+    byte[] bSrc = new byte[7 * N];
+    byte[] bDst = new byte[7 * N];
+    byte[] bRef = new byte[7 * N];
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("--add-modules", "java.base",
+                                   "--add-exports", "java.base/jdk.internal.misc=ALL-UNNAMED");
+    }
+
+    void init() {
+        for (int i = 0; i < iSrc.length; i++) {
+            iSrc[i] = RANDOM.nextInt();
+        }
+        RANDOM.nextBytes(bSrc);
+        Arrays.fill(iDst, 0);
+        Arrays.fill(iRef, 0);
+        Arrays.fill(bDst, (byte)0);
+        Arrays.fill(bRef, (byte)0);
+    }
+
+    static void verify(String name, int[] actual, int[] expected) {
+        if (!Arrays.equals(actual, expected)) {
+            throw new RuntimeException(name + ": wrong result, mismatch at index " +
+                                       Arrays.mismatch(actual, expected));
+        }
+    }
+
+    static void verify(String name, byte[] actual, byte[] expected) {
+        if (!Arrays.equals(actual, expected)) {
+            throw new RuntimeException(name + ": wrong result, mismatch at index " +
+                                       Arrays.mismatch(actual, expected));
+        }
+    }
+
+    // ------------------------------------------------------------------
+    // Accepted: structs of 12, 28 and 7 bytes. MulLNode::Ideal reduces
+    // "* 12L" to AddL of two shifts and "* 7L" to SubL of a shift, while
+    // "* 28L" stays a MulL.
+    // ------------------------------------------------------------------
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, "> 0", IRNode.ADD_VI, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIf = {"AlignVector", "false"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"})
+    static void unsafeScale12(int[] dst, int[] src, int n) {
+        for (int i = 0; i < n; i++) {
+            UNSAFE.putInt(dst, BASE_I + i * 12L + 0, UNSAFE.getInt(src, BASE_I + i * 12L + 0) + 1);
+            UNSAFE.putInt(dst, BASE_I + i * 12L + 4, UNSAFE.getInt(src, BASE_I + i * 12L + 4) + 1);
+            UNSAFE.putInt(dst, BASE_I + i * 12L + 8, UNSAFE.getInt(src, BASE_I + i * 12L + 8) + 1);
+        }
+    }
+
+    @DontCompile
+    static void unsafeScale12Ref(int[] dst, int[] src, int n) {
+        for (int i = 0; i < 3 * n; i++) {
+            dst[i] = src[i] + 1;
+        }
+    }
+
+    @Run(test = "unsafeScale12")
+    void runUnsafeScale12() {
+        init();
+        unsafeScale12(iDst, iSrc, N);
+        unsafeScale12Ref(iRef, iSrc, N);
+        verify("unsafeScale12", iDst, iRef);
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, "> 0", IRNode.ADD_VI, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIf = {"AlignVector", "false"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"})
+    static void unsafeScale28(int[] dst, int[] src, int n) {
+        for (int i = 0; i < n; i++) {
+            for (int k = 0; k < 28; k += 4) {
+                UNSAFE.putInt(dst, BASE_I + i * 28L + k, UNSAFE.getInt(src, BASE_I + i * 28L + k) + 1);
+            }
+        }
+    }
+
+    @DontCompile
+    static void unsafeScale28Ref(int[] dst, int[] src, int n) {
+        for (int i = 0; i < 7 * n; i++) {
+            dst[i] = src[i] + 1;
+        }
+    }
+
+    @Run(test = "unsafeScale28")
+    void runUnsafeScale28() {
+        init();
+        unsafeScale28(iDst, iSrc, N);
+        unsafeScale28Ref(iRef, iSrc, N);
+        verify("unsafeScale28", iDst, iRef);
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_B, "> 0", IRNode.ADD_VB, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIf = {"AlignVector", "false"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"})
+    static void unsafeScale7(byte[] dst, byte[] src, int n) {
+        for (int i = 0; i < n; i++) {
+            for (int k = 0; k < 7; k++) {
+                UNSAFE.putByte(dst, BASE_B + i * 7L + k, (byte)(UNSAFE.getByte(src, BASE_B + i * 7L + k) + 1));
+            }
+        }
+    }
+
+    @DontCompile
+    static void unsafeScale7Ref(byte[] dst, byte[] src, int n) {
+        for (int i = 0; i < 7 * n; i++) {
+            dst[i] = (byte)(src[i] + 1);
+        }
+    }
+
+    @Run(test = "unsafeScale7")
+    void runUnsafeScale7() {
+        init();
+        unsafeScale7(bDst, bSrc, N);
+        unsafeScale7Ref(bRef, bSrc, N);
+        verify("unsafeScale7", bDst, bRef);
+    }
+
+    // MemorySegment accesses with a long offset go through a long bounds
+    // check that is not eliminated from an int loop, so these are only
+    // checked for correct results.
+
+    @Test
+    static void segmentHeapScale12(MemorySegment dst, MemorySegment src, int n) {
+        for (int i = 0; i < n; i++) {
+            dst.set(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 0, src.get(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 0) + 1);
+            dst.set(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 4, src.get(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 4) + 1);
+            dst.set(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 8, src.get(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 8) + 1);
+        }
+    }
+
+    @Run(test = "segmentHeapScale12")
+    void runSegmentHeapScale12() {
+        init();
+        segmentHeapScale12(MemorySegment.ofArray(iDst), MemorySegment.ofArray(iSrc), N);
+        unsafeScale12Ref(iRef, iSrc, N);
+        verify("segmentHeapScale12", iDst, iRef);
+    }
+
+    final MemorySegment nativeSeg = Arena.ofAuto().allocate(12L * N, 8);
+
+    @Test
+    static void segmentNativeScale12(MemorySegment seg, int n) {
+        for (int i = 0; i < n; i++) {
+            seg.set(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 0, seg.get(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 0) + 1);
+            seg.set(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 4, seg.get(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 4) + 1);
+            seg.set(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 8, seg.get(ValueLayout.JAVA_INT_UNALIGNED, i * 12L + 8) + 1);
+        }
+    }
+
+    @Run(test = "segmentNativeScale12")
+    void runSegmentNativeScale12() {
+        init();
+        MemorySegment.copy(iSrc, 0, nativeSeg, ValueLayout.JAVA_INT_UNALIGNED, 0, 3 * N);
+        segmentNativeScale12(nativeSeg, N);
+        MemorySegment.copy(nativeSeg, ValueLayout.JAVA_INT_UNALIGNED, 0, iDst, 0, 3 * N);
+        unsafeScale12Ref(iRef, iSrc, N);
+        verify("segmentNativeScale12", iDst, iRef);
+    }
+
+    // ------------------------------------------------------------------
+    // Rejected: the scale or the offset does not fit in an int, or the
+    // scaled expression contains an invariant.
+    // ------------------------------------------------------------------
+
+    // The MulL scale is out of int range; subtracting i << 32 brings the
+    // address back to i * 12.
+    @Test
+    @IR(failOn = {IRNode.LOAD_VECTOR_I, IRNode.STORE_VECTOR})
+    static void unsafeScaleOverflow(int[] dst, int[] src, int n) {
+        for (int i = 0; i < n; i++) {
+            for (int k = 0; k < 12; k += 4) {
+                long off = BASE_I + i * BIG_SCALE - ((long)i << 32) + k;
+                UNSAFE.putInt(dst, off, UNSAFE.getInt(src, off) + 1);
+            }
+        }
+    }
+
+    @Run(test = "unsafeScaleOverflow")
+    void runUnsafeScaleOverflow() {
+        init();
+        unsafeScaleOverflow(iDst, iSrc, N);
+        unsafeScale12Ref(iRef, iSrc, N);
+        verify("unsafeScaleOverflow", iDst, iRef);
+    }
+
+    // The int offset BIG times 28 is out of int range.
+    @Test
+    @IR(failOn = {IRNode.LOAD_VECTOR_I, IRNode.STORE_VECTOR})
+    static void unsafeOffsetOverflow(int[] dst, int[] src, int n) {
+        for (int i = 0; i < n; i++) {
+            for (int k = 0; k < 28; k += 4) {
+                long off = BASE_I + (long)(i + BIG) * 28L - BIG * 28L + k;
+                UNSAFE.putInt(dst, off, UNSAFE.getInt(src, off) + 1);
+            }
+        }
+    }
+
+    @Run(test = "unsafeOffsetOverflow")
+    void runUnsafeOffsetOverflow() {
+        init();
+        unsafeOffsetOverflow(iDst, iSrc, N);
+        unsafeScale28Ref(iRef, iSrc, N);
+        verify("unsafeOffsetOverflow", iDst, iRef);
+    }
+
+    // The invariant is scaled together with the iv, for the MulL and the
+    // two-shift forms.
+    @Test
+    @IR(failOn = {IRNode.LOAD_VECTOR_I, IRNode.STORE_VECTOR})
+    static void unsafeScale28Invar(int[] dst, int[] src, int n, int inv) {
+        for (int i = 0; i < n; i++) {
+            for (int k = 0; k < 28; k += 4) {
+                long off = BASE_I + (long)(i + inv) * 28L + k;
+                UNSAFE.putInt(dst, off, UNSAFE.getInt(src, off) + 1);
+            }
+        }
+    }
+
+    @DontCompile
+    static void scaleInvarRef(int[] dst, int[] src, int n, int inv, int ints) {
+        for (int i = ints * inv; i < ints * (n + inv); i++) {
+            dst[i] = src[i] + 1;
+        }
+    }
+
+    @Run(test = "unsafeScale28Invar")
+    void runUnsafeScale28Invar() {
+        init();
+        int inv = RANDOM.nextInt(MAX_INV);
+        unsafeScale28Invar(iDst, iSrc, N, inv);
+        scaleInvarRef(iRef, iSrc, N, inv, 7);
+        verify("unsafeScale28Invar", iDst, iRef);
+    }
+
+    @Test
+    @IR(failOn = {IRNode.LOAD_VECTOR_I, IRNode.STORE_VECTOR})
+    static void unsafeScale12Invar(int[] dst, int[] src, int n, int inv) {
+        for (int i = 0; i < n; i++) {
+            for (int k = 0; k < 12; k += 4) {
+                long off = BASE_I + (long)(i + inv) * 12L + k;
+                UNSAFE.putInt(dst, off, UNSAFE.getInt(src, off) + 1);
+            }
+        }
+    }
+
+    @Run(test = "unsafeScale12Invar")
+    void runUnsafeScale12Invar() {
+        init();
+        int inv = RANDOM.nextInt(MAX_INV);
+        unsafeScale12Invar(iDst, iSrc, N, inv);
+        scaleInvarRef(iRef, iSrc, N, inv, 3);
+        verify("unsafeScale12Invar", iDst, iRef);
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.java.awt.font;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.awt.Font;
+import java.awt.Graphics2D;
+import java.awt.RenderingHints;
+import java.awt.font.FontRenderContext;
+import java.awt.font.GlyphVector;
+import java.awt.font.TextLayout;
+import java.awt.image.BufferedImage;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Lays out and draws the same short strings over and over, the way a
+ * report generator renders headers and labels. layout() exercises the
+ * HarfBuzz shaper, draw() the glyph rasterizer and strike caches.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Fork(value = 3, jvmArgsAppend = {"-Djava.awt.headless=true"})
+public class TextLayoutThroughput {
+
+    static final String[] LABELS = {
+        "Quarterly Revenue Summary",
+        "Total (incl. VAT)",
+        "Page 1 of 12",
+        "Généré le 14/10/2024 à 09:30",
+    };
+
+    Font font;
+    FontRenderContext frc;
+    BufferedImage image;
+    Graphics2D g;
+
+    @Setup
+    public void setup() {
+        font = new Font(Font.SANS_SERIF, Font.PLAIN, 12);
+        frc = new FontRenderContext(null, true, true);
+        image = new BufferedImage(400, 40, BufferedImage.TYPE_INT_ARGB);
+        g = image.createGraphics();
+        g.setRenderingHint(RenderingHints.KEY_TEXT_ANTIALIASING,
+                           RenderingHints.VALUE_TEXT_ANTIALIAS_ON);
+        g.setFont(font);
+    }
+
+    @TearDown
+    public void tearDown() {
+        g.dispose();
+    }
+
+    @Benchmark
+    public float layout() {
+        float advance = 0;
+        for (String s : LABELS) {
+            advance += new TextLayout(s, font, frc).getAdvance();
+        }
+        return advance;
+    }
+
+    @Benchmark
+    public int glyphVector() {
+        int glyphs = 0;
+        for (String s : LABELS) {
+            GlyphVector gv = font.layoutGlyphVector(frc, s.toCharArray(), 0, s.length(),
+                                                    Font.LAYOUT_LEFT_TO_RIGHT);
+            glyphs += gv.getNumGlyphs();
+        }
+        return glyphs;
+    }
+
+    @Benchmark
+    public void draw() {
+        for (String s : LABELS) {
+            g.drawString(s, 0, 20);
+        }
+    }
+}
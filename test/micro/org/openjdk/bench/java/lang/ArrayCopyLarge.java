@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.java.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Copies around and above the size at which the x86 AVX-512 arraycopy stubs
+ * switch to non-temporal stores (see -XX:ArrayCopyNonTemporalThreshold).
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Fork(value = 3)
+public class ArrayCopyLarge {
+
+    @Param({"1048576", "4194304", "33554432", "134217728"})
+    int size;
+
+    byte[] srcBytes;
+    byte[] dstBytes;
+    long[] srcLongs;
+    long[] dstLongs;
+
+    @Setup
+    public void setup() {
+        srcBytes = new byte[size];
+        dstBytes = new byte[size];
+        srcLongs = new long[size / Long.BYTES];
+        dstLongs = new long[size / Long.BYTES];
+        for (int i = 0; i < srcLongs.length; i++) {
+            srcLongs[i] = i;
+        }
+    }
+
+    @Benchmark
+    public void copyBytes() {
+        System.arraycopy(srcBytes, 0, dstBytes, 0, size);
+    }
+
+    @Benchmark
+    public void copyLongs() {
+        System.arraycopy(srcLongs, 0, dstLongs, 0, srcLongs.length);
+    }
+}
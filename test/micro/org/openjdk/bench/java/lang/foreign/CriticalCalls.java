@@ -56,6 +56,8 @@ public class CriticalCalls {
 
     static final MethodHandle PINNED;
     static final MethodHandle NOT_PINNED;
+    static final MethodHandle HASH_PINNED;
+    static final MethodHandle HASH_NOT_PINNED;
 
     static {
         System.loadLibrary("CriticalCalls");
@@ -72,13 +74,27 @@ public class CriticalCalls {
             sumIntsSym,
             sumIntsDesc,
             Linker.Option.critical(false));
+
+        MemorySegment hashBytesSym = lookup.findOrThrow("hash_bytes");
+        FunctionDescriptor hashBytesDesc = FunctionDescriptor.of(JAVA_INT, ADDRESS, JAVA_INT);
+
+        HASH_PINNED = Linker.nativeLinker().downcallHandle(
+            hashBytesSym,
+            hashBytesDesc,
+            Linker.Option.critical(true));
+        HASH_NOT_PINNED = Linker.nativeLinker().downcallHandle(
+            hashBytesSym,
+            hashBytesDesc,
+            Linker.Option.critical(false));
     }
 
     @Param({"100", "10000", "1000000"})
     int size;
 
     int[] arr;
+    byte[] bytes;
     SegmentAllocator recycler;
+    SegmentAllocator bytesRecycler;
 
     @Setup
     public void setup() {
@@ -88,6 +104,12 @@ public void setup() {
         }
 
         recycler = SegmentAllocator.prefixAllocator(Arena.ofAuto().allocate(JAVA_INT, arr.length));
+
+        bytes = new byte[size];
+        for (int i = 0; i < size; i++) {
+            bytes[i] = (byte) i;
+        }
+        bytesRecycler = SegmentAllocator.prefixAllocator(Arena.ofAuto().allocate(JAVA_BYTE, bytes.length));
     }
 
     @Benchmark
@@ -108,4 +130,18 @@ public int callRecycled() throws Throwable {
         MemorySegment nativeArr = recycler.allocateFrom(JAVA_INT, arr);
         return (int) NOT_PINNED.invokeExact(nativeArr, arr.length);
     }
+
+    // Hashing a byte[]: passing the heap segment directly to a critical
+    // downcall versus copying the array into native memory first.
+
+    @Benchmark
+    public int hashPinned() throws Throwable {
+        return (int) HASH_PINNED.invokeExact(MemorySegment.ofArray(bytes), bytes.length);
+    }
+
+    @Benchmark
+    public int hashRecycled() throws Throwable {
+        MemorySegment nativeBytes = bytesRecycler.allocateFrom(JAVA_BYTE, bytes);
+        return (int) HASH_NOT_PINNED.invokeExact(nativeBytes, bytes.length);
+    }
 }
@@ -30,3 +30,11 @@ EXPORT int sum_ints(int* arr, int size) {
   }
   return sum;
 }
+
+EXPORT unsigned int hash_bytes(const unsigned char* arr, int size) {
+  unsigned int hash = 2166136261u;
+  for (int i = 0; i < size; i++) {
+    hash = (hash ^ arr[i]) * 16777619u;
+  }
+  return hash;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.java.nio;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.IOException;
+import java.net.InetAddress;
+import java.net.InetSocketAddress;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.channels.ServerSocketChannel;
+import java.nio.channels.SocketChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.StandardOpenOption;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Zero-copy transfers from a file. On Linux, file-to-file transfers and
+ * Files.copy use copy_file_range, and file-to-socket transfers use sendfile.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Fork(value = 3)
+public class FileChannelTransfer {
+
+    @Param({"65536", "16777216"})
+    int size;
+
+    Path dir;
+    Path src;
+    Path dst;
+    FileChannel srcChannel;
+    FileChannel dstChannel;
+
+    ServerSocketChannel server;
+    SocketChannel client;
+    SocketChannel peer;
+    Thread drainer;
+
+    @Setup
+    public void setup() throws IOException {
+        dir = Files.createTempDirectory("FileChannelTransfer");
+        src = dir.resolve("src");
+        dst = dir.resolve("dst");
+        Files.write(src, new byte[size]);
+        srcChannel = FileChannel.open(src, StandardOpenOption.READ);
+        dstChannel = FileChannel.open(dst, StandardOpenOption.CREATE, StandardOpenOption.WRITE);
+
+        server = ServerSocketChannel.open();
+        server.bind(new InetSocketAddress(InetAddress.getLoopbackAddress(), 0));
+        client = SocketChannel.open(server.getLocalAddress());
+        peer = server.accept();
+
+        // Discard everything sent to the peer so that transferTo never blocks.
+        drainer = new Thread(() -> {
+            ByteBuffer buf = ByteBuffer.allocateDirect(1 << 16);
+            try {
+                while (peer.read(buf.clear()) >= 0) {
+                }
+            } catch (IOException e) {
+                // closed
+            }
+        });
+        drainer.setDaemon(true);
+        drainer.start();
+    }
+
+    @TearDown
+    public void tearDown() throws IOException, InterruptedException {
+        client.close();
+        drainer.join();
+        peer.close();
+        server.close();
+        srcChannel.close();
+        dstChannel.close();
+        Files.deleteIfExists(src);
+        Files.deleteIfExists(dst);
+        Files.deleteIfExists(dir.resolve("copy"));
+        Files.delete(dir);
+    }
+
+    @Benchmark
+    public long fileToFile() throws IOException {
+        // Overwrite the same range every time instead of growing the file
+        dstChannel.position(0);
+        long n = 0;
+        while (n < size) {
+            n += srcChannel.transferTo(n, size - n, dstChannel);
+        }
+        return n;
+    }
+
+    @Benchmark
+    public long fileToSocket() throws IOException {
+        long n = 0;
+        while (n < size) {
+            n += srcChannel.transferTo(n, size - n, client);
+        }
+        return n;
+    }
+
+    @Benchmark
+    public Path filesCopy() throws IOException {
+        return Files.copy(src, dir.resolve("copy"), StandardCopyOption.REPLACE_EXISTING);
+    }
+}
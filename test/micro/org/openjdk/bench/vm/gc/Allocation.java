@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Allocation paths: TLAB bump-pointer allocation, allocation with TLABs
+ * disabled, and humongous arrays that G1 places in dedicated regions.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public abstract class Allocation {
+
+    @Param({"16", "1024"})
+    int size;
+
+    @Benchmark
+    public Object allocObject() {
+        return new Object();
+    }
+
+    @Benchmark
+    public byte[] allocArray() {
+        return new byte[size];
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx1g", "-Xms1g"})
+    public static class TLAB extends Allocation {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx1g", "-Xms1g", "-XX:-UseTLAB"})
+    public static class NoTLAB extends Allocation {}
+
+    /**
+     * Arrays of at least half a region are humongous in G1; with
+     * -XX:G1HeapRegionSize=1m these sizes are all humongous.
+     */
+    @State(Scope.Thread)
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx1g", "-Xms1g", "-XX:G1HeapRegionSize=1m"})
+    public static class Humongous {
+
+        @Param({"524288", "4194304"})
+        int bytes;
+
+        @Benchmark
+        public byte[] allocHumongous() {
+            return new byte[bytes];
+        }
+    }
+}
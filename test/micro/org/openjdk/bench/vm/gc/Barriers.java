@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Cost of reference loads and stores through the collector barriers: the
+ * G1 pre/post barriers, the ZGC load and store barriers and the Shenandoah
+ * SATB/load-reference barriers. Each nested class runs the same benchmarks
+ * with a different collector.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public abstract class Barriers {
+
+    @Param({"1024"})
+    int size;
+
+    Object[] refs;
+    Object[] values;
+    Holder[] holders;
+
+    static class Holder {
+        Object field;
+    }
+
+    @Setup
+    public void setup() {
+        refs = new Object[size];
+        values = new Object[size];
+        for (int i = 0; i < size; i++) {
+            values[i] = new Object();
+        }
+        holders = new Holder[size];
+        for (int i = 0; i < size; i++) {
+            holders[i] = new Holder();
+        }
+    }
+
+    @Benchmark
+    public void storeArray() {
+        Object[] r = refs;
+        Object[] v = values;
+        for (int i = 0; i < r.length; i++) {
+            r[i] = v[i];
+        }
+    }
+
+    @Benchmark
+    public void storeNullArray() {
+        Object[] r = refs;
+        for (int i = 0; i < r.length; i++) {
+            r[i] = null;
+        }
+    }
+
+    @Benchmark
+    public void storeField() {
+        // Distinct holders, so that no store is dead
+        Holder[] h = holders;
+        Object[] v = values;
+        for (int i = 0; i < v.length; i++) {
+            h[i].field = v[i];
+        }
+    }
+
+    @Benchmark
+    public int loadArray() {
+        Object[] v = values;
+        int hash = 0;
+        for (int i = 0; i < v.length; i++) {
+            hash += (v[i] == null) ? 0 : 1;
+        }
+        return hash;
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC"})
+    public static class G1 extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseZGC"})
+    public static class Z extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseShenandoahGC"})
+    public static class Shenandoah extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseParallelGC"})
+    public static class Parallel extends Barriers {}
+}
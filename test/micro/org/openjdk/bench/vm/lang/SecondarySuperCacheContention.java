@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Group;
+import org.openjdk.jmh.annotations.GroupThreads;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Two groups of threads check the same receiver class against two
+ * different interfaces through the runtime's C++ subtype check
+ * (Klass::search_secondary_supers). The Class.isAssignableFrom intrinsic
+ * is disabled, so each check goes through JNI IsAssignableFrom instead of
+ * the compiled secondary supers check. With the linear scan
+ * (-XX:-UseSecondarySupersTable) each miss rewrites
+ * Klass::_secondary_super_cache, so the threads ping-pong its cache line;
+ * the hashed table does not.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Group)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(value = 3, jvmArgsAppend = {"-XX:+UnlockDiagnosticVMOptions",
+                                  "-XX:DisableIntrinsic=_isAssignableFrom"})
+public class SecondarySuperCacheContention {
+
+    interface I1 {}
+    interface I2 {}
+    interface I3 {}
+    interface I4 {}
+
+    static class Impl implements I1, I2, I3, I4 {}
+
+    Class<?> cls;
+
+    @Setup
+    public void setup() {
+        cls = new Impl().getClass();
+    }
+
+    @Benchmark
+    @Group("contended")
+    @GroupThreads(2)
+    public boolean checkI1() {
+        return I1.class.isAssignableFrom(cls);
+    }
+
+    @Benchmark
+    @Group("contended")
+    @GroupThreads(2)
+    public boolean checkI4() {
+        return I4.class.isAssignableFrom(cls);
+    }
+}
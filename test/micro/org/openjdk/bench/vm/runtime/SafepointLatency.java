@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.runtime;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Round-trip latency of a global safepoint and of a single-thread handshake
+ * while a number of threads are busy running compiled Java code.
+ * Thread.getAllStackTraces() executes a thread dump VM operation at a
+ * safepoint; Thread.getStackTrace() on another thread uses a handshake with
+ * only that thread.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Benchmark)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Fork(value = 3)
+public class SafepointLatency {
+
+    @Param({"1", "16", "64"})
+    int threads;
+
+    Thread[] spinners;
+    volatile boolean stop;
+
+    static volatile long sink;
+
+    static void spin(SafepointLatency state) {
+        long x = 0;
+        while (!state.stop) {
+            x += System.nanoTime() & 1;
+        }
+        sink = x;
+    }
+
+    @Setup
+    public void setup() {
+        stop = false;
+        spinners = new Thread[threads];
+        for (int i = 0; i < threads; i++) {
+            spinners[i] = new Thread(() -> spin(this));
+            spinners[i].setDaemon(true);
+            spinners[i].start();
+        }
+    }
+
+    @TearDown
+    public void tearDown() throws InterruptedException {
+        stop = true;
+        for (Thread t : spinners) {
+            t.join();
+        }
+    }
+
+    @Benchmark
+    public Object safepoint() {
+        return Thread.getAllStackTraces();
+    }
+
+    @Benchmark
+    public Object handshake() {
+        return spinners[0].getStackTrace();
+    }
+}